@@ -11,36 +11,18 @@
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "chrome/browser/browser_process.h"
-#include "chrome/browser/content_settings/tab_specific_content_settings.h"
 #include "components/prefs/pref_change_registrar.h"
 #include "components/prefs/pref_service.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
-#include "content/public/browser/render_frame_host.h"
-#include "content/public/browser/web_contents.h"
 #include "net/url_request/url_request.h"
 
 using content::BrowserThread;
 using net::URLRequest;
 
-
-namespace {
-
-  content::WebContents* GetWebContentsFromProcessAndFrameId(
-      int render_process_id, int render_frame_id) {
-  if (render_process_id) {
-    content::RenderFrameHost* rfh =
-        content::RenderFrameHost::FromID(render_process_id, render_frame_id);
-    return content::WebContents::FromRenderFrameHost(rfh);
-  }
-  return content::WebContents::FromFrameTreeNodeId(render_frame_id);
-}
-
-}  // namespace
-
 BraveNetworkDelegateBase::BraveNetworkDelegateBase(
     extensions::EventRouterForwarder* event_router)
-    : ChromeNetworkDelegate(event_router), referral_headers_list_(nullptr) {
+    : ChromeNetworkDelegate(event_router) {
   // Initialize the preference change registrar.
   base::PostTaskWithTraits(
       FROM_HERE, {BrowserThread::UI},
@@ -79,8 +61,21 @@ void BraveNetworkDelegateBase::GetReferralHeaders() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
   const base::ListValue* referral_headers =
       g_browser_process->local_state()->GetList(kReferralHeaders);
-  if (referral_headers)
-    referral_headers_list_ = referral_headers->CreateDeepCopy();
+  if (!referral_headers)
+    return;
+  // Compile the list here and hand it over, so requests never touch the
+  // pref value.
+  base::PostTaskWithTraits(
+      FROM_HERE, {BrowserThread::IO},
+      base::BindOnce(&BraveNetworkDelegateBase::SetReferralHeaders,
+                     base::Unretained(this),
+                     brave::ReferralHeadersIndex::Create(*referral_headers)));
+}
+
+void BraveNetworkDelegateBase::SetReferralHeaders(
+    scoped_refptr<const brave::ReferralHeadersIndex> referral_headers) {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+  referral_headers_ = std::move(referral_headers);
 }
 
 int BraveNetworkDelegateBase::OnBeforeURLRequest(URLRequest* request,
@@ -94,6 +89,7 @@ int BraveNetworkDelegateBase::OnBeforeURLRequest(URLRequest* request,
   brave::BraveRequestInfo::FillCTXFromRequest(request, ctx);
   ctx->new_url = new_url;
   ctx->event_type = brave::kOnBeforeRequest;
+  ctx->referrer_decision_cache = &referrer_decision_cache_;
   callbacks_[request->identifier()] = std::move(callback);
   RunNextCallback(request, ctx);
   return net::ERR_IO_PENDING;
@@ -111,7 +107,7 @@ int BraveNetworkDelegateBase::OnBeforeStartTransaction(URLRequest* request,
   brave::BraveRequestInfo::FillCTXFromRequest(request, ctx);
   ctx->event_type = brave::kOnBeforeStartTransaction;
   ctx->headers = headers;
-  ctx->referral_headers_list = referral_headers_list_.get();
+  ctx->referral_headers = referral_headers_;
   callbacks_[request->identifier()] = std::move(callback);
   RunNextCallback(request, ctx);
   return net::ERR_IO_PENDING;
@@ -153,8 +149,8 @@ bool BraveNetworkDelegateBase::OnCanGetCookies(const URLRequest& request,
     bool allowed_from_caller) {
   std::shared_ptr<brave::BraveRequestInfo> ctx(
       new brave::BraveRequestInfo());
-  brave::BraveRequestInfo::FillCTXFromRequest(&request, ctx);
   ctx->event_type = brave::kOnCanGetCookies;
+  brave::BraveRequestInfo::FillCTXFromRequest(&request, ctx);
   bool allow = std::all_of(can_get_cookies_callbacks_.begin(), can_get_cookies_callbacks_.end(),
       [&ctx](brave::OnCanGetCookiesCallback callback){
         return callback.Run(ctx);
@@ -165,14 +161,8 @@ bool BraveNetworkDelegateBase::OnCanGetCookies(const URLRequest& request,
   int frame_tree_node_id;
   brave_shields::GetRenderFrameInfo(&request, &frame_id, &process_id,
       &frame_tree_node_id);
-  base::RepeatingCallback<content::WebContents*(void)> wc_getter =
-      base::BindRepeating(&GetWebContentsFromProcessAndFrameId, process_id,
-                          frame_id);
-  base::PostTaskWithTraits(
-      FROM_HERE, {BrowserThread::UI},
-      base::BindOnce(&TabSpecificContentSettings::CookiesRead, wc_getter,
-          request.url(), request.site_for_cookies(), cookie_list,
-          !allow));
+  cookie_access_aggregator_.CookiesRead(process_id, frame_id, request.url(),
+      request.site_for_cookies(), cookie_list, !allow);
 
   return allow;
 }
@@ -183,8 +173,8 @@ bool BraveNetworkDelegateBase::OnCanSetCookie(const URLRequest& request,
     bool allowed_from_caller) {
   std::shared_ptr<brave::BraveRequestInfo> ctx(
       new brave::BraveRequestInfo());
-  brave::BraveRequestInfo::FillCTXFromRequest(&request, ctx);
   ctx->event_type = brave::kOnCanSetCookies;
+  brave::BraveRequestInfo::FillCTXFromRequest(&request, ctx);
   bool allow = std::all_of(can_set_cookies_callbacks_.begin(), can_set_cookies_callbacks_.end(),
       [&ctx](brave::OnCanSetCookiesCallback callback){
         return callback.Run(ctx);
@@ -195,14 +185,8 @@ bool BraveNetworkDelegateBase::OnCanSetCookie(const URLRequest& request,
   int frame_tree_node_id;
   brave_shields::GetRenderFrameInfo(&request, &frame_id, &process_id,
       &frame_tree_node_id);
-  base::RepeatingCallback<content::WebContents*(void)> wc_getter =
-      base::BindRepeating(&GetWebContentsFromProcessAndFrameId, process_id,
-                          frame_id);
-  base::PostTaskWithTraits(
-      FROM_HERE, {BrowserThread::UI},
-      base::BindOnce(&TabSpecificContentSettings::CookieChanged, wc_getter,
-          request.url(), request.site_for_cookies(), cookie,
-          !allow));
+  cookie_access_aggregator_.CookieChanged(process_id, frame_id, request.url(),
+      request.site_for_cookies(), cookie, !allow);
 
   return allow;
 }
@@ -311,6 +295,20 @@ void BraveNetworkDelegateBase::RunNextCallback(
   }
 }
 
+void BraveNetworkDelegateBase::OnCompleted(URLRequest* request,
+    bool started,
+    int net_error) {
+  // Let the content settings UI catch up with the cookies this request used.
+  int frame_id;
+  int process_id;
+  int frame_tree_node_id;
+  brave_shields::GetRenderFrameInfo(request, &frame_id, &process_id,
+      &frame_tree_node_id);
+  cookie_access_aggregator_.FlushFrame(process_id, frame_id);
+
+  ChromeNetworkDelegate::OnCompleted(request, started, net_error);
+}
+
 void BraveNetworkDelegateBase::OnURLRequestDestroyed(URLRequest* request) {
   if (ContainsKey(callbacks_, request->identifier())) {
     callbacks_.erase(request->identifier());
@@ -5,7 +5,10 @@
 #ifndef BRAVE_BROWSER_NET_BRAVE_NETWORK_DELEGATE_BASE_H_
 #define BRAVE_BROWSER_NET_BRAVE_NETWORK_DELEGATE_BASE_H_
 
+#include "brave/browser/net/cookie_access_aggregator.h"
+#include "brave/browser/net/referrer_decision_cache.h"
 #include "brave/browser/net/url_context.h"
+#include "brave/components/brave_referrals/browser/referral_headers_index.h"
 #include "chrome/browser/net/chrome_network_delegate.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/completion_callback.h"
@@ -57,6 +60,9 @@ class BraveNetworkDelegateBase : public ChromeNetworkDelegate {
                       net::CookieOptions* options,
                       bool allowed_from_caller) override;
 
+  void OnCompleted(net::URLRequest* request,
+                   bool started,
+                   int net_error) override;
   void OnURLRequestDestroyed(net::URLRequest* request) override;
   void RunCallbackForRequestIdentifier(uint64_t request_identifier, int rv);
 
@@ -79,8 +85,14 @@ class BraveNetworkDelegateBase : public ChromeNetworkDelegate {
   void InitPrefChangeRegistrar();
   void GetReferralHeaders();
   void OnReferralHeadersChanged();
-  std::unique_ptr<base::ListValue> referral_headers_list_;
+  void SetReferralHeaders(
+      scoped_refptr<const brave::ReferralHeadersIndex> referral_headers);
+  // Current snapshot, only swapped and read on the IO thread. Requests hold
+  // their own reference through BraveRequestInfo.
+  scoped_refptr<const brave::ReferralHeadersIndex> referral_headers_;
   std::map<uint64_t, net::CompletionOnceCallback> callbacks_;
+  brave::CookieAccessAggregator cookie_access_aggregator_;
+  brave::ReferrerDecisionCache referrer_decision_cache_;
   std::unique_ptr<PrefChangeRegistrar, content::BrowserThread::DeleteOnUIThread>
       pref_change_registrar_;
 
@@ -4,11 +4,7 @@
 
 #include "brave/browser/net/brave_referrals_network_delegate_helper.h"
 
-#include "base/values.h"
-#include "brave/components/brave_referrals/browser/brave_referrals_service.h"
-#include "chrome/browser/browser_process.h"
-#include "content/public/browser/browser_thread.h"
-#include "extensions/common/url_pattern.h"
+#include "brave/components/brave_referrals/browser/referral_headers_index.h"
 #include "net/url_request/url_request.h"
 
 namespace brave {
@@ -18,16 +14,16 @@ int OnBeforeStartTransaction_ReferralsWork(
     net::HttpRequestHeaders* headers,
     const ResponseCallback& next_callback,
     std::shared_ptr<BraveRequestInfo> ctx) {
-  if (!ctx->referral_headers_list)
+  if (!ctx->referral_headers)
     return net::OK;
   // If the domain for this request matches one of our target domains,
   // set the associated custom headers.
-  const base::DictionaryValue* request_headers_dict = nullptr;
-  if (!BraveReferralsService::GetMatchingReferralHeaders(
-          *ctx->referral_headers_list, &request_headers_dict, request->url()))
+  const ReferralHeadersIndex::Headers* request_headers =
+      ctx->referral_headers->GetMatchingHeaders(request->url());
+  if (!request_headers)
     return net::OK;
-  for (const auto& it : request_headers_dict->DictItems()) {
-    headers->SetHeader(it.first, it.second.GetString());
+  for (const auto& it : *request_headers) {
+    headers->SetHeader(it.first, it.second);
   }
   return net::OK;
 }
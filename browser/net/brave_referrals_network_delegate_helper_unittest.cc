@@ -7,6 +7,7 @@
 #include "base/json/json_reader.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/common/network_constants.h"
+#include "brave/components/brave_referrals/browser/referral_headers_index.h"
 #include "chrome/test/base/chrome_render_view_host_test_harness.h"
 #include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
 #include "net/url_request/url_request_test_util.h"
@@ -76,12 +77,14 @@ TEST_F(BraveReferralsNetworkDelegateHelperTest, ReplaceHeadersForMatchingDomain)
 
   base::ListValue referral_headers_list =
       base::ListValue(referral_headers->GetList());
+  scoped_refptr<const brave::ReferralHeadersIndex> referral_headers_index =
+      brave::ReferralHeadersIndex::Create(referral_headers_list);
 
   net::HttpRequestHeaders headers;
   brave::ResponseCallback callback;
   std::shared_ptr<brave::BraveRequestInfo> brave_request_info(
       new brave::BraveRequestInfo());
-  brave_request_info->referral_headers_list = &referral_headers_list;
+  brave_request_info->referral_headers = referral_headers_index;
   int ret = brave::OnBeforeStartTransaction_ReferralsWork(
       request.get(), &headers, callback, brave_request_info);
 
@@ -105,12 +108,14 @@ TEST_F(BraveReferralsNetworkDelegateHelperTest, NoReplaceHeadersForNonMatchingDo
 
   base::ListValue referral_headers_list =
       base::ListValue(referral_headers->GetList());
+  scoped_refptr<const brave::ReferralHeadersIndex> referral_headers_index =
+      brave::ReferralHeadersIndex::Create(referral_headers_list);
 
   net::HttpRequestHeaders headers;
   brave::ResponseCallback callback;
   std::shared_ptr<brave::BraveRequestInfo> brave_request_info(
       new brave::BraveRequestInfo());
-  brave_request_info->referral_headers_list = &referral_headers_list;
+  brave_request_info->referral_headers = referral_headers_index;
   int ret = brave::OnBeforeStartTransaction_ReferralsWork(
       request.get(), &headers, callback, brave_request_info);
 
@@ -119,4 +124,33 @@ TEST_F(BraveReferralsNetworkDelegateHelperTest, NoReplaceHeadersForNonMatchingDo
   EXPECT_EQ(ret, net::OK);
 }
 
+TEST_F(BraveReferralsNetworkDelegateHelperTest, MatchesDomainAndSubdomains) {
+  std::unique_ptr<base::Value> referral_headers =
+      base::JSONReader().ReadToValue(kTestReferralHeaders);
+  ASSERT_TRUE(referral_headers);
+  ASSERT_TRUE(referral_headers->is_list());
+  scoped_refptr<const brave::ReferralHeadersIndex> referral_headers_index =
+      brave::ReferralHeadersIndex::Create(
+          base::ListValue(referral_headers->GetList()));
+
+  const brave::ReferralHeadersIndex::Headers* headers =
+      referral_headers_index->GetMatchingHeaders(GURL("http://xxlmag.com/a"));
+  ASSERT_TRUE(headers);
+  ASSERT_EQ(1u, headers->size());
+  EXPECT_EQ("X-Brave-Partner", (*headers)[0].first);
+  EXPECT_EQ("townsquare", (*headers)[0].second);
+
+  headers = referral_headers_index->GetMatchingHeaders(
+      GURL("https://a.b.barrons.com/"));
+  ASSERT_TRUE(headers);
+  EXPECT_EQ("dowjones", (*headers)[0].second);
+
+  EXPECT_FALSE(referral_headers_index->GetMatchingHeaders(
+      GURL("https://notbarrons.com/")));
+  EXPECT_FALSE(referral_headers_index->GetMatchingHeaders(
+      GURL("https://barrons.com.evil/")));
+  EXPECT_FALSE(referral_headers_index->GetMatchingHeaders(
+      GURL("ftp://barrons.com/")));
+}
+
 }  // namespace
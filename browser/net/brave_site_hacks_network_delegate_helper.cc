@@ -8,6 +8,7 @@
 
 #include "base/sequenced_task_runner.h"
 #include "base/strings/string_util.h"
+#include "brave/browser/net/referrer_decision_cache.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/shield_exceptions.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
@@ -24,26 +25,43 @@ using content::Referrer;
 
 namespace {
 
-bool ApplyPotentialReferrerBlock(net::URLRequest* request) {
+bool ApplyPotentialReferrerBlock(net::URLRequest* request,
+    const brave::BraveRequestInfo& ctx) {
   DCHECK_CURRENTLY_ON(BrowserThread::IO);
-  GURL target_origin = GURL(request->url()).GetOrigin();
-  GURL tab_origin = request->site_for_cookies().GetOrigin();
-  bool allow_referrers = brave_shields::IsAllowContentSettingFromIO(
-      request, tab_origin, tab_origin, CONTENT_SETTINGS_TYPE_PLUGINS,
-      brave_shields::kReferrers);
-  bool shields_up = brave_shields::IsAllowContentSettingFromIO(
-      request, tab_origin, GURL(), CONTENT_SETTINGS_TYPE_PLUGINS,
-      brave_shields::kBraveShields);
-  const std::string original_referrer = request->referrer();
-  Referrer new_referrer;
-  if (brave_shields::ShouldSetReferrer(allow_referrers, shields_up,
-          GURL(original_referrer), tab_origin, request->url(), target_origin,
-          Referrer::NetReferrerPolicyToBlinkReferrerPolicy(
-              request->referrer_policy()), &new_referrer)) {
-    request->SetReferrer(new_referrer.url.spec());
-    return true;
+  // Nothing to strip, which also spares all the lookups below.
+  if (request->referrer().empty())
+    return false;
+
+  const GURL original_referrer(request->referrer());
+  const GURL target_origin = request->url().GetOrigin();
+  const GURL& tab_origin = ctx.tab_origin;
+
+  brave::ReferrerDecisionCache* cache = ctx.referrer_decision_cache;
+  std::string key;
+  bool should_block = false;
+  if (cache) {
+    key = brave::ReferrerDecisionCache::GetKey(tab_origin, target_origin,
+        original_referrer.GetOrigin());
   }
-  return false;
+  if (!cache ||
+      !cache->Get(key, ctx.shields_settings_generation, &should_block)) {
+    bool allow_referrers = brave_shields::IsAllowContentSettingFromIO(
+        request, tab_origin, tab_origin, CONTENT_SETTINGS_TYPE_PLUGINS,
+        brave_shields::kReferrers);
+    should_block = brave_shields::ShouldBlockReferrer(allow_referrers,
+        ctx.allow_brave_shields, original_referrer, tab_origin,
+        request->url());
+    if (cache)
+      cache->Put(key, ctx.shields_settings_generation, should_block);
+  }
+  if (!should_block)
+    return false;
+
+  const Referrer new_referrer = Referrer::SanitizeForRequest(request->url(),
+      Referrer(target_origin, Referrer::NetReferrerPolicyToBlinkReferrerPolicy(
+          request->referrer_policy())));
+  request->SetReferrer(new_referrer.url.spec());
+  return true;
 }
 
 }  // namespace
@@ -54,7 +72,8 @@ int OnBeforeURLRequest_SiteHacksWork(
     const ResponseCallback& next_callback,
     std::shared_ptr<BraveRequestInfo> ctx) {
 
-  if (ApplyPotentialReferrerBlock(const_cast<net::URLRequest*>(ctx->request))) {
+  if (ApplyPotentialReferrerBlock(const_cast<net::URLRequest*>(ctx->request),
+                                  *ctx)) {
     ctx->new_url_spec = ctx->request_url.spec();
     ctx->referrer_changed = true;
   }
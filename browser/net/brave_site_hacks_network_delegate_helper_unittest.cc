@@ -4,6 +4,7 @@
 
 #include "brave/browser/net/brave_site_hacks_network_delegate_helper.h"
 
+#include "brave/browser/net/referrer_decision_cache.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/common/network_constants.h"
 #include "chrome/test/base/chrome_render_view_host_test_harness.h"
@@ -271,4 +272,52 @@ TEST_F(BraveSiteHacksNetworkDelegateHelperTest, ReferrerCleared) {
   });
 }
 
+TEST_F(BraveSiteHacksNetworkDelegateHelperTest, ReferrerDecisionCached) {
+  brave::ReferrerDecisionCache cache;
+  const GURL url("https://digg.com/7");
+  const std::string original_referrer = "https://hello.brianbondy.com/about";
+  // Requests without a frame have no tab origin.
+  const std::string key = brave::ReferrerDecisionCache::GetKey(
+      GURL(), url.GetOrigin(), GURL(original_referrer).GetOrigin());
+
+  // Returns the referrer the request ends up with.
+  auto run_request = [this, &cache, &url, &original_referrer](
+      uint64_t shields_settings_generation) {
+    net::TestDelegate test_delegate;
+    std::unique_ptr<net::URLRequest> request =
+        context()->CreateRequest(url, net::IDLE, &test_delegate,
+                                 TRAFFIC_ANNOTATION_FOR_TESTS);
+    request->SetReferrer(original_referrer);
+
+    std::shared_ptr<brave::BraveRequestInfo>
+        brave_request_info(new brave::BraveRequestInfo());
+    brave::BraveRequestInfo::FillCTXFromRequest(request.get(), brave_request_info);
+    brave_request_info->referrer_decision_cache = &cache;
+    brave_request_info->shields_settings_generation =
+        shields_settings_generation;
+    brave::ResponseCallback callback;
+    int ret = brave::OnBeforeURLRequest_SiteHacksWork(callback, brave_request_info);
+    EXPECT_EQ(ret, net::OK);
+    return request->referrer();
+  };
+
+  // Miss: the decision is made from the settings and remembered.
+  EXPECT_EQ(url.GetOrigin().spec(), run_request(0));
+  bool should_block = false;
+  EXPECT_TRUE(cache.Get(key, 0, &should_block));
+  EXPECT_TRUE(should_block);
+
+  // Hit: a remembered decision wins over the settings, so plant one the
+  // settings would never make.
+  cache.Put(key, 0, false);
+  EXPECT_EQ(original_referrer, run_request(0));
+
+  // A shields change bumps the generation, so the planted decision is
+  // dropped and the settings are consulted again.
+  EXPECT_EQ(url.GetOrigin().spec(), run_request(1));
+  should_block = false;
+  EXPECT_TRUE(cache.Get(key, 1, &should_block));
+  EXPECT_TRUE(should_block);
+}
+
 }  // namespace
@@ -0,0 +1,182 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/cookie_access_aggregator.h"
+
+#include <algorithm>
+
+#include "base/bind.h"
+#include "base/task/post_task.h"
+#include "chrome/browser/content_settings/tab_specific_content_settings.h"
+#include "content/public/browser/browser_task_traits.h"
+#include "content/public/browser/browser_thread.h"
+#include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/web_contents.h"
+
+using content::BrowserThread;
+
+namespace brave {
+
+namespace {
+
+// How long cookie accesses are collected before they are reported.
+constexpr base::TimeDelta kFlushDelay = base::TimeDelta::FromMilliseconds(200);
+
+content::WebContents* GetWebContentsFromProcessAndFrameId(
+    int render_process_id, int render_frame_id) {
+  if (render_process_id) {
+    content::RenderFrameHost* rfh =
+        content::RenderFrameHost::FromID(render_process_id, render_frame_id);
+    return content::WebContents::FromRenderFrameHost(rfh);
+  }
+  return content::WebContents::FromFrameTreeNodeId(render_frame_id);
+}
+
+// Merges |cookies| into |cookie_list|, replacing the cookies with the same
+// name, domain and path.
+void MergeCookies(const net::CookieList& cookies,
+                  net::CookieList* cookie_list) {
+  for (const auto& cookie : cookies) {
+    auto it = std::find_if(cookie_list->begin(), cookie_list->end(),
+        [&cookie](const net::CanonicalCookie& existing) {
+          return existing.IsEquivalent(cookie);
+        });
+    if (it != cookie_list->end())
+      *it = cookie;
+    else
+      cookie_list->push_back(cookie);
+  }
+}
+
+}  // namespace
+
+CookieAccessAggregator::Report::Report() {
+}
+
+CookieAccessAggregator::Report::Report(const Report& other) = default;
+
+CookieAccessAggregator::Report::~Report() {
+}
+
+CookieAccessAggregator::CookieAccessAggregator()
+    : report_callback_(
+          base::BindRepeating(&CookieAccessAggregator::ReportOnUI)) {
+  DETACH_FROM_SEQUENCE(sequence_checker_);
+}
+
+CookieAccessAggregator::~CookieAccessAggregator() {
+  Flush();
+}
+
+void CookieAccessAggregator::SetReportCallbackForTesting(
+    const ReportCallback& callback) {
+  report_callback_ = callback;
+}
+
+CookieAccessAggregator::Reports* CookieAccessAggregator::GetFrameReports(
+    int render_process_id, int render_frame_id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (!flush_timer_.IsRunning()) {
+    flush_timer_.Start(FROM_HERE, kFlushDelay,
+        base::Bind(&CookieAccessAggregator::Flush, base::Unretained(this)));
+  }
+  return &pending_reports_[FrameKey(render_process_id, render_frame_id)];
+}
+
+void CookieAccessAggregator::CookiesRead(int render_process_id,
+    int render_frame_id,
+    const GURL& url,
+    const GURL& first_party_url,
+    const net::CookieList& cookie_list,
+    bool blocked_by_policy) {
+  Reports* reports = GetFrameReports(render_process_id, render_frame_id);
+  // Merging into a read from before the last change would report the change
+  // first.
+  for (auto it = reports->rbegin(); it != reports->rend() && !it->is_change;
+       ++it) {
+    if (it->url == url && it->first_party_url == first_party_url &&
+        it->blocked_by_policy == blocked_by_policy) {
+      MergeCookies(cookie_list, &it->cookie_list);
+      return;
+    }
+  }
+
+  reports->emplace_back();
+  Report& read = reports->back();
+  read.url = url;
+  read.first_party_url = first_party_url;
+  read.cookie_list = cookie_list;
+  read.blocked_by_policy = blocked_by_policy;
+}
+
+void CookieAccessAggregator::CookieChanged(int render_process_id,
+    int render_frame_id,
+    const GURL& url,
+    const GURL& first_party_url,
+    const net::CanonicalCookie& cookie,
+    bool blocked_by_policy) {
+  Reports* reports = GetFrameReports(render_process_id, render_frame_id);
+  reports->emplace_back();
+  Report& change = reports->back();
+  change.is_change = true;
+  change.url = url;
+  change.first_party_url = first_party_url;
+  change.cookie_list.push_back(cookie);
+  change.blocked_by_policy = blocked_by_policy;
+}
+
+void CookieAccessAggregator::FlushFrame(int render_process_id,
+                                        int render_frame_id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  auto it = pending_reports_.find(FrameKey(render_process_id, render_frame_id));
+  if (it == pending_reports_.end())
+    return;
+  PostReports(it->first, std::move(it->second));
+  pending_reports_.erase(it);
+  if (pending_reports_.empty())
+    flush_timer_.Stop();
+}
+
+void CookieAccessAggregator::Flush() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  flush_timer_.Stop();
+  for (auto& frame_reports : pending_reports_)
+    PostReports(frame_reports.first, std::move(frame_reports.second));
+  pending_reports_.clear();
+}
+
+void CookieAccessAggregator::PostReports(const FrameKey& key,
+                                         Reports reports) {
+  base::PostTaskWithTraits(
+      FROM_HERE, {BrowserThread::UI},
+      base::BindOnce(report_callback_, key.first, key.second,
+                     std::move(reports)));
+}
+
+// static
+void CookieAccessAggregator::ReportOnUI(int render_process_id,
+    int render_frame_id,
+    const Reports& reports) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  base::RepeatingCallback<content::WebContents*(void)> wc_getter =
+      base::BindRepeating(&GetWebContentsFromProcessAndFrameId,
+                          render_process_id, render_frame_id);
+  // Skip all the reports at once when the frame is already gone.
+  if (!wc_getter.Run())
+    return;
+
+  for (const auto& report : reports) {
+    if (report.is_change) {
+      TabSpecificContentSettings::CookieChanged(wc_getter, report.url,
+          report.first_party_url, report.cookie_list.front(),
+          report.blocked_by_policy);
+    } else {
+      TabSpecificContentSettings::CookiesRead(wc_getter, report.url,
+          report.first_party_url, report.cookie_list,
+          report.blocked_by_policy);
+    }
+  }
+}
+
+}  // namespace brave
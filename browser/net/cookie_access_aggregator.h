@@ -0,0 +1,96 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_COOKIE_ACCESS_AGGREGATOR_H_
+#define BRAVE_BROWSER_NET_COOKIE_ACCESS_AGGREGATOR_H_
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/sequence_checker.h"
+#include "base/timer/timer.h"
+#include "net/cookies/canonical_cookie.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+// Collects the cookie accesses seen by the network delegate on the IO thread
+// and reports them to TabSpecificContentSettings in a single UI task per
+// frame, instead of posting one task (with a copy of the cookies) per cookie
+// access. A frame's accesses are reported when one of its requests completes,
+// or after a short delay for accesses that are not followed by a completion.
+// Repeated reads of the same URL are merged into a single CookiesRead() call
+// unless a cookie change was seen in between, so the order of reads and
+// changes within a frame is preserved.
+class CookieAccessAggregator {
+ public:
+  // One cookie access.
+  struct Report {
+    Report();
+    Report(const Report& other);
+    ~Report();
+
+    bool is_change = false;
+    GURL url;
+    GURL first_party_url;
+    // The cookies read, or the single cookie that was changed.
+    net::CookieList cookie_list;
+    bool blocked_by_policy = false;
+  };
+  using Reports = std::vector<Report>;
+  using ReportCallback = base::RepeatingCallback<void(int render_process_id,
+                                                      int render_frame_id,
+                                                      const Reports& reports)>;
+
+  CookieAccessAggregator();
+  ~CookieAccessAggregator();
+
+  void CookiesRead(int render_process_id,
+                   int render_frame_id,
+                   const GURL& url,
+                   const GURL& first_party_url,
+                   const net::CookieList& cookie_list,
+                   bool blocked_by_policy);
+  void CookieChanged(int render_process_id,
+                     int render_frame_id,
+                     const GURL& url,
+                     const GURL& first_party_url,
+                     const net::CanonicalCookie& cookie,
+                     bool blocked_by_policy);
+
+  // Reports everything collected so far for one frame, e.g. when one of its
+  // requests completed.
+  void FlushFrame(int render_process_id, int render_frame_id);
+  // Reports everything collected so far.
+  void Flush();
+
+  // Replaces the UI thread task that forwards reports to
+  // TabSpecificContentSettings.
+  void SetReportCallbackForTesting(const ReportCallback& callback);
+
+ private:
+  // (render_process_id, render_frame_id)
+  using FrameKey = std::pair<int, int>;
+
+  Reports* GetFrameReports(int render_process_id, int render_frame_id);
+  void PostReports(const FrameKey& key, Reports reports);
+  static void ReportOnUI(int render_process_id,
+                         int render_frame_id,
+                         const Reports& reports);
+
+  std::map<FrameKey, Reports> pending_reports_;
+  base::OneShotTimer flush_timer_;
+  ReportCallback report_callback_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+
+  DISALLOW_COPY_AND_ASSIGN(CookieAccessAggregator);
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_COOKIE_ACCESS_AGGREGATOR_H_
@@ -0,0 +1,136 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/cookie_access_aggregator.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/run_loop.h"
+#include "base/time/time.h"
+#include "content/public/test/test_browser_thread_bundle.h"
+#include "net/cookies/cookie_options.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+using brave::CookieAccessAggregator;
+
+const int kProcessId = 1;
+const int kFrameId = 2;
+const int kOtherFrameId = 3;
+
+struct FrameReports {
+  int render_frame_id;
+  CookieAccessAggregator::Reports reports;
+};
+
+net::CanonicalCookie MakeCookie(const GURL& url,
+                                const std::string& cookie_line) {
+  std::unique_ptr<net::CanonicalCookie> cookie = net::CanonicalCookie::Create(
+      url, cookie_line, base::Time::Now(), net::CookieOptions());
+  return *cookie;
+}
+
+class CookieAccessAggregatorTest : public testing::Test {
+ public:
+  CookieAccessAggregatorTest()
+      : url_("https://brave.com/"),
+        other_url_("https://tracker.com/") {
+    aggregator_.SetReportCallbackForTesting(
+        base::BindRepeating(&CookieAccessAggregatorTest::OnReports,
+                            base::Unretained(this)));
+  }
+
+ protected:
+  void OnReports(int render_process_id,
+                 int render_frame_id,
+                 const CookieAccessAggregator::Reports& reports) {
+    EXPECT_EQ(kProcessId, render_process_id);
+    reported_.push_back({render_frame_id, reports});
+  }
+
+  content::TestBrowserThreadBundle thread_bundle_;
+  const GURL url_;
+  const GURL other_url_;
+  CookieAccessAggregator aggregator_;
+  std::vector<FrameReports> reported_;
+};
+
+TEST_F(CookieAccessAggregatorTest, MergesRepeatedReads) {
+  net::CookieList first;
+  first.push_back(MakeCookie(url_, "a=1"));
+  first.push_back(MakeCookie(url_, "b=1"));
+  net::CookieList second;
+  second.push_back(MakeCookie(url_, "a=2"));
+  second.push_back(MakeCookie(url_, "c=1"));
+
+  aggregator_.CookiesRead(kProcessId, kFrameId, url_, url_, first, false);
+  aggregator_.CookiesRead(kProcessId, kFrameId, other_url_, url_, first, true);
+  aggregator_.CookiesRead(kProcessId, kFrameId, url_, url_, second, false);
+  aggregator_.Flush();
+  base::RunLoop().RunUntilIdle();
+
+  ASSERT_EQ(1u, reported_.size());
+  const auto& reports = reported_[0].reports;
+  ASSERT_EQ(2u, reports.size());
+  EXPECT_EQ(url_, reports[0].url);
+  // The second read replaced "a" instead of adding a copy of it.
+  ASSERT_EQ(3u, reports[0].cookie_list.size());
+  EXPECT_EQ("a", reports[0].cookie_list[0].Name());
+  EXPECT_EQ("2", reports[0].cookie_list[0].Value());
+  EXPECT_EQ("b", reports[0].cookie_list[1].Name());
+  EXPECT_EQ("c", reports[0].cookie_list[2].Name());
+  EXPECT_EQ(other_url_, reports[1].url);
+  EXPECT_EQ(2u, reports[1].cookie_list.size());
+}
+
+TEST_F(CookieAccessAggregatorTest, KeepsReadsAndChangesInOrder) {
+  net::CookieList cookies;
+  cookies.push_back(MakeCookie(url_, "a=1"));
+
+  aggregator_.CookiesRead(kProcessId, kFrameId, url_, url_, cookies, false);
+  aggregator_.CookieChanged(kProcessId, kFrameId, url_, url_,
+                            MakeCookie(url_, "a=2"), false);
+  aggregator_.CookiesRead(kProcessId, kFrameId, url_, url_, cookies, false);
+  aggregator_.Flush();
+  base::RunLoop().RunUntilIdle();
+
+  ASSERT_EQ(1u, reported_.size());
+  const auto& reports = reported_[0].reports;
+  ASSERT_EQ(3u, reports.size());
+  EXPECT_FALSE(reports[0].is_change);
+  EXPECT_TRUE(reports[1].is_change);
+  EXPECT_EQ("2", reports[1].cookie_list[0].Value());
+  EXPECT_FALSE(reports[2].is_change);
+}
+
+TEST_F(CookieAccessAggregatorTest, FlushFrameReportsOnlyThatFrame) {
+  net::CookieList cookies;
+  cookies.push_back(MakeCookie(url_, "a=1"));
+
+  aggregator_.CookiesRead(kProcessId, kFrameId, url_, url_, cookies, false);
+  aggregator_.CookiesRead(kProcessId, kOtherFrameId, url_, url_, cookies,
+                          false);
+  aggregator_.FlushFrame(kProcessId, kFrameId);
+  base::RunLoop().RunUntilIdle();
+
+  ASSERT_EQ(1u, reported_.size());
+  EXPECT_EQ(kFrameId, reported_[0].render_frame_id);
+
+  // Accesses after a flush start a new batch.
+  aggregator_.CookieChanged(kProcessId, kFrameId, url_, url_,
+                            MakeCookie(url_, "a=2"), false);
+  aggregator_.Flush();
+  base::RunLoop().RunUntilIdle();
+
+  ASSERT_EQ(3u, reported_.size());
+  EXPECT_EQ(kFrameId, reported_[1].render_frame_id);
+  EXPECT_TRUE(reported_[1].reports[0].is_change);
+  EXPECT_EQ(kOtherFrameId, reported_[2].render_frame_id);
+}
+
+}  // namespace
@@ -0,0 +1,58 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/referrer_decision_cache.h"
+
+#include "url/gurl.h"
+
+namespace brave {
+
+namespace {
+
+const size_t kMaxReferrerDecisions = 512;
+
+}  // namespace
+
+ReferrerDecisionCache::ReferrerDecisionCache()
+    : decisions_(kMaxReferrerDecisions),
+      generation_(0) {
+}
+
+ReferrerDecisionCache::~ReferrerDecisionCache() {
+}
+
+// static
+std::string ReferrerDecisionCache::GetKey(const GURL& tab_origin,
+                                          const GURL& target_origin,
+                                          const GURL& referrer_origin) {
+  // Specs can't contain spaces, so the key is unambiguous.
+  return tab_origin.possibly_invalid_spec() + " " +
+      target_origin.possibly_invalid_spec() + " " +
+      referrer_origin.possibly_invalid_spec();
+}
+
+bool ReferrerDecisionCache::Get(const std::string& key,
+                                uint64_t generation,
+                                bool* should_block) {
+  if (generation != generation_) {
+    decisions_.Clear();
+    generation_ = generation;
+    return false;
+  }
+  auto it = decisions_.Get(key);
+  if (it == decisions_.end())
+    return false;
+  *should_block = it->second;
+  return true;
+}
+
+void ReferrerDecisionCache::Put(const std::string& key,
+                                uint64_t generation,
+                                bool should_block) {
+  if (generation != generation_)
+    return;
+  decisions_.Put(key, should_block);
+}
+
+}  // namespace brave
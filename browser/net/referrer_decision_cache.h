@@ -0,0 +1,47 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_REFERRER_DECISION_CACHE_H_
+#define BRAVE_BROWSER_NET_REFERRER_DECISION_CACHE_H_
+
+#include <stdint.h>
+
+#include <string>
+
+#include "base/containers/mru_cache.h"
+#include "base/macros.h"
+
+class GURL;
+
+namespace brave {
+
+// Remembers whether shields strip the referrer of requests between a given
+// (tab origin, target origin, referrer origin), so repeated requests skip the
+// referrer content setting lookup, the same-site comparison and the referrer
+// whitelist. Everything is dropped as soon as the profile's shields settings
+// generation changes. Lives on the IO thread, one per profile network
+// delegate.
+class ReferrerDecisionCache {
+ public:
+  ReferrerDecisionCache();
+  ~ReferrerDecisionCache();
+
+  static std::string GetKey(const GURL& tab_origin,
+                            const GURL& target_origin,
+                            const GURL& referrer_origin);
+
+  // Returns false if there is no decision for |key| made under |generation|.
+  bool Get(const std::string& key, uint64_t generation, bool* should_block);
+  void Put(const std::string& key, uint64_t generation, bool should_block);
+
+ private:
+  base::HashingMRUCache<std::string, bool> decisions_;
+  uint64_t generation_;
+
+  DISALLOW_COPY_AND_ASSIGN(ReferrerDecisionCache);
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_REFERRER_DECISION_CACHE_H_
@@ -7,12 +7,32 @@
 
 #include <string>
 
+#include "brave/components/brave_referrals/browser/referral_headers_index.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "brave/components/content_settings/core/browser/brave_cookie_settings.h"
+#include "chrome/browser/profiles/profile_io_data.h"
 #include "content/public/browser/resource_request_info.h"
 
 namespace brave {
 
+namespace {
+
+const content_settings::BraveCookieSettings* GetCookieSettingsFromIO(
+    const net::URLRequest* request) {
+  const content::ResourceRequestInfo* resource_info =
+      content::ResourceRequestInfo::ForRequest(request);
+  ProfileIOData* io_data = resource_info ?
+      ProfileIOData::FromResourceContext(resource_info->GetContext()) :
+      nullptr;
+  if (!io_data)
+    return nullptr;
+  return static_cast<const content_settings::BraveCookieSettings*>(
+      io_data->GetCookieSettings());
+}
+
+}  // namespace
+
 BraveRequestInfo::BraveRequestInfo() {
 }
 
@@ -30,21 +50,32 @@ void BraveRequestInfo::FillCTXFromRequest(const net::URLRequest* request,
   }
   brave_shields::GetRenderFrameInfo(request, &ctx->render_process_id, &ctx->render_frame_id,
       &ctx->frame_tree_node_id);
-  ctx->allow_brave_shields = brave_shields::IsAllowContentSettingFromIO(
-      request, ctx->tab_origin, ctx->tab_origin, CONTENT_SETTINGS_TYPE_PLUGINS,
-      brave_shields::kBraveShields);
-  ctx->allow_ads = brave_shields::IsAllowContentSettingFromIO(
-      request, ctx->tab_origin, ctx->tab_origin, CONTENT_SETTINGS_TYPE_PLUGINS,
-      brave_shields::kAds);
-  ctx->allow_http_upgradable_resource = brave_shields::IsAllowContentSettingFromIO(
-      request, ctx->tab_origin, ctx->tab_origin, CONTENT_SETTINGS_TYPE_PLUGINS,
-      brave_shields::kHTTPUpgradableResources);
-  ctx->allow_1p_cookies = brave_shields::IsAllowContentSettingFromIO(
-      request, ctx->tab_origin, GURL("https://firstParty/"), CONTENT_SETTINGS_TYPE_PLUGINS,
-      brave_shields::kCookies);
-  ctx->allow_3p_cookies = brave_shields::IsAllowContentSettingFromIO(
-      request, ctx->tab_origin, GURL(), CONTENT_SETTINGS_TYPE_PLUGINS,
-      brave_shields::kCookies);
+  // Shields and cookie settings come from the per-profile cache shared with
+  // BraveCookieSettings.
+  const content_settings::BraveCookieSettings* brave_cookie_settings =
+      GetCookieSettingsFromIO(request);
+  const auto cookie_settings = brave_cookie_settings ?
+      brave_cookie_settings->GetShieldsCookieSettings(ctx->tab_origin) :
+      content_settings::BraveCookieSettings::ShieldsCookieSettings();
+  if (brave_cookie_settings) {
+    ctx->shields_settings_generation =
+        brave_cookie_settings->GetShieldsSettingsGeneration();
+  }
+  ctx->allow_brave_shields = cookie_settings.allow_brave_shields;
+  ctx->allow_1p_cookies = cookie_settings.allow_1p_cookies;
+  ctx->allow_3p_cookies = cookie_settings.allow_3p_cookies;
+  // Cookie callbacks don't look at the other shields settings.
+  if (ctx->event_type != kOnCanGetCookies &&
+      ctx->event_type != kOnCanSetCookies) {
+    ctx->allow_ads = brave_shields::IsAllowContentSettingFromIO(
+        request, ctx->tab_origin, ctx->tab_origin,
+        CONTENT_SETTINGS_TYPE_PLUGINS, brave_shields::kAds);
+    ctx->allow_http_upgradable_resource =
+        brave_shields::IsAllowContentSettingFromIO(
+            request, ctx->tab_origin, ctx->tab_origin,
+            CONTENT_SETTINGS_TYPE_PLUGINS,
+            brave_shields::kHTTPUpgradableResources);
+  }
   ctx->request = request;
 }
 
@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "base/memory/ref_counted.h"
 #include "chrome/browser/net/chrome_network_delegate.h"
 #include "content/public/common/resource_type.h"
 #include "net/url_request/url_request.h"
@@ -17,6 +18,8 @@ class BraveNetworkDelegateBase;
 
 namespace brave {
 
+class ReferralHeadersIndex;
+class ReferrerDecisionCache;
 struct BraveRequestInfo;
 using ResponseCallback = base::Callback<void()>;
 
@@ -68,7 +71,9 @@ struct BraveRequestInfo {
   scoped_refptr<net::HttpResponseHeaders>* override_response_headers = nullptr;
   GURL* allowed_unsafe_redirect_url = nullptr;
   BraveNetworkDelegateEventType event_type = kUnknownEventType;
-  const base::ListValue* referral_headers_list = nullptr;
+  scoped_refptr<const ReferralHeadersIndex> referral_headers;
+  ReferrerDecisionCache* referrer_decision_cache = nullptr;
+  uint64_t shields_settings_generation = 0;
   BlockedBy blocked_by = kNotBlocked;
   // Default to invalid type for resource_type, so delegate helpers
   // can properly detect that the info couldn't be obtained.
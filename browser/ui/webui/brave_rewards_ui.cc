@@ -4,6 +4,10 @@
 
 #include "brave/browser/ui/webui/brave_rewards_ui.h"
 
+#include <map>
+#include <memory>
+#include <string>
+
 #include "base/base64.h"
 #include "base/memory/weak_ptr.h"
 
@@ -37,6 +41,34 @@ using content::WebUIMessageHandler;
 
 namespace {
 
+std::unique_ptr<base::DictionaryValue> ContentSiteToValue(
+    const brave_rewards::ContentSite& item) {
+  auto publisher = std::make_unique<base::DictionaryValue>();
+  publisher->SetString("id", item.id);
+  publisher->SetDouble("percentage", item.percentage);
+  publisher->SetString("publisherKey", item.id);
+  publisher->SetBoolean("verified", item.verified);
+  publisher->SetInteger("excluded", item.excluded);
+  publisher->SetString("name", item.name);
+  publisher->SetString("provider", item.provider);
+  publisher->SetString("url", item.url);
+  publisher->SetString("favIcon", item.favicon_url);
+  return publisher;
+}
+
+// Compares the fields ContentSiteToValue() sends.
+bool IsSameContentSite(const brave_rewards::ContentSite& a,
+                       const brave_rewards::ContentSite& b) {
+  return a.id == b.id &&
+      a.percentage == b.percentage &&
+      a.verified == b.verified &&
+      a.excluded == b.excluded &&
+      a.name == b.name &&
+      a.provider == b.provider &&
+      a.url == b.url &&
+      a.favicon_url == b.favicon_url;
+}
+
 // The handler for Javascript messages for Brave about: pages
 class RewardsDOMHandler : public WebUIMessageHandler,
                           public brave_rewards::RewardsNotificationServiceObserver,
@@ -124,12 +156,23 @@ class RewardsDOMHandler : public WebUIMessageHandler,
           notifications_list) override;
 
   brave_rewards::RewardsService* rewards_service_;  // NOT OWNED
+
+  // The contribute list as last sent to the page, by publisher id. Updates
+  // are sent as patches against it, tagged with |contribute_list_version_|;
+  // the page asks for the full list again when it misses one.
+  std::map<std::string, brave_rewards::ContentSite> contribute_list_;
+  uint32_t contribute_list_version_;
+  bool send_full_contribute_list_;
+
   base::WeakPtrFactory<RewardsDOMHandler> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(RewardsDOMHandler);
 };
 
-RewardsDOMHandler::RewardsDOMHandler() : weak_factory_(this) {}
+RewardsDOMHandler::RewardsDOMHandler()
+    : contribute_list_version_(0),
+      send_full_contribute_list_(true),
+      weak_factory_(this) {}
 
 RewardsDOMHandler::~RewardsDOMHandler() {
   if (rewards_service_)
@@ -522,24 +565,54 @@ void RewardsDOMHandler::RestorePublishers(const base::ListValue *args) {
 }
 
 void RewardsDOMHandler::OnGetContentSiteList(std::unique_ptr<brave_rewards::ContentSiteList> list, uint32_t record) {
-  if (web_ui()->CanCallJavascript()) {
+  if (!web_ui()->CanCallJavascript())
+    return;
+
+  std::map<std::string, brave_rewards::ContentSite> contribute_list;
+  for (auto const& item : *list)
+    contribute_list.emplace(item.id, item);
+
+  if (send_full_contribute_list_) {
+    send_full_contribute_list_ = false;
+    contribute_list_version_++;
+
     auto publishers = std::make_unique<base::ListValue>();
-    for (auto const& item : *list) {
-      auto publisher = std::make_unique<base::DictionaryValue>();
-      publisher->SetString("id", item.id);
-      publisher->SetDouble("percentage", item.percentage);
-      publisher->SetString("publisherKey", item.id);
-      publisher->SetBoolean("verified", item.verified);
-      publisher->SetInteger("excluded", item.excluded);
-      publisher->SetString("name", item.name);
-      publisher->SetString("provider", item.provider);
-      publisher->SetString("url", item.url);
-      publisher->SetString("favIcon", item.favicon_url);
-      publishers->Append(std::move(publisher));
-    }
+    for (auto const& item : *list)
+      publishers->Append(ContentSiteToValue(item));
+
+    contribute_list_.swap(contribute_list);
+    web_ui()->CallJavascriptFunctionUnsafe("brave_rewards.contributeList",
+        *publishers, base::Value(static_cast<int>(contribute_list_version_)));
+    return;
+  }
+
+  // Only send the rows that changed, the page keeps the list sorted itself.
+  auto updated = std::make_unique<base::ListValue>();
+  for (auto const& item : contribute_list) {
+    auto old_item = contribute_list_.find(item.first);
+    if (old_item == contribute_list_.end() ||
+        !IsSameContentSite(old_item->second, item.second))
+      updated->Append(ContentSiteToValue(item.second));
+  }
 
-    web_ui()->CallJavascriptFunctionUnsafe("brave_rewards.contributeList", *publishers);
+  auto removed = std::make_unique<base::ListValue>();
+  for (auto const& item : contribute_list_) {
+    if (contribute_list.find(item.first) == contribute_list.end())
+      removed->AppendString(item.first);
   }
+
+  if (updated->empty() && removed->empty())
+    return;
+
+  base::DictionaryValue patch;
+  patch.SetInteger("baseVersion", contribute_list_version_);
+  patch.SetInteger("version", ++contribute_list_version_);
+  patch.SetList("updated", std::move(updated));
+  patch.SetList("removed", std::move(removed));
+
+  contribute_list_.swap(contribute_list);
+  web_ui()->CallJavascriptFunctionUnsafe("brave_rewards.contributeListPatch",
+                                         patch);
 }
 
 
@@ -640,6 +713,7 @@ void RewardsDOMHandler::UpdateTipsList(const base::ListValue *args) {
 
 void RewardsDOMHandler::GetContributionList(const base::ListValue *args) {
   if (rewards_service_) {
+    send_full_contribute_list_ = true;
     OnContentSiteUpdated(rewards_service_);
   }
 }
@@ -32,4 +32,6 @@ const char kReferralCheckedForPromoCodeFile[] = "brave.referral.checked_for_prom
 const char kHTTPSEVerywhereControlType[] = "brave.https_everywhere_default";
 const char kNoScriptControlType[] = "brave.no_script_default";
 const char kRewardsNotifications[] = "brave.rewards.notifications";
+const char kRewardsNotificationEntries[] =
+    "brave.rewards.notification_entries";
 const char kMigratedMuonProfile[] = "brave.muon.migrated_profile";
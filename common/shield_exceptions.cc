@@ -8,6 +8,7 @@
 #include <map>
 #include <vector>
 
+#include "base/containers/flat_set.h"
 #include "extensions/common/url_pattern.h"
 #include "url/gurl.h"
 
@@ -141,4 +142,48 @@ bool IsWidevineInstallableURL(const GURL& url) {
     });
 }
 
+bool IsAutoplayWhitelisted(const GURL& url) {
+  // Each entry matches the domain and all of its subdomains on any scheme,
+  // like a "[*.]domain" content settings pattern.
+  static base::flat_set<std::string> domains({
+    "example.com",
+    "youtube.com",
+    "khanacademy.org",
+    "twitch.tv",
+    "vimeo.com",
+    "udemy.com",
+    "duolingo.com",
+    "giphy.com",
+    "imgur.com",
+    "netflix.com",
+    "hulu.com",
+    "primevideo.com",
+    "dailymotion.com",
+    "tv.com",
+    "viewster.com",
+    "metacafe.com",
+    "d.tube",
+    "spotify.com",
+    "lynda.com",
+    "soundcloud.com",
+    "pandora.com",
+    "periscope.tv",
+    "pscp.tv",
+  });
+
+  const std::string& host = url.host();
+  if (host.empty())
+    return false;
+  // probe the host and each of its parent domains
+  size_t pos = 0;
+  while (true) {
+    if (domains.count(host.substr(pos)))
+      return true;
+    pos = host.find('.', pos);
+    if (pos == std::string::npos)
+      return false;
+    ++pos;
+  }
+}
+
 }
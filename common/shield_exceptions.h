@@ -14,5 +14,6 @@ bool IsWhitelistedCookieExeption(const GURL& firstPartyOrigin,
 bool IsWhitelistedReferrer(const GURL& firstPartyOrigin,
                            const GURL& subresourceUrl);
 bool IsWidevineInstallableURL(const GURL& url);
+bool IsAutoplayWhitelisted(const GURL& url);
 
 }  // namespace brave
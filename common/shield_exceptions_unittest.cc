@@ -81,4 +81,16 @@ TEST_F(BraveShieldsExceptionsTest, IsWhitelistedReferrer) {
       GURL("http://api.geetest.com/")));
 }
 
+TEST_F(BraveShieldsExceptionsTest, IsAutoplayWhitelisted) {
+  EXPECT_TRUE(brave::IsAutoplayWhitelisted(GURL("https://youtube.com/")));
+  EXPECT_TRUE(brave::IsAutoplayWhitelisted(
+      GURL("https://www.youtube.com/watch?v=1")));
+  EXPECT_TRUE(brave::IsAutoplayWhitelisted(GURL("http://m.twitch.tv:8080/")));
+  EXPECT_TRUE(brave::IsAutoplayWhitelisted(GURL("https://d.tube/")));
+  EXPECT_FALSE(brave::IsAutoplayWhitelisted(GURL("https://notyoutube.com/")));
+  EXPECT_FALSE(brave::IsAutoplayWhitelisted(GURL("https://youtube.com.evil/")));
+  EXPECT_FALSE(brave::IsAutoplayWhitelisted(GURL("https://tv/")));
+  EXPECT_FALSE(brave::IsAutoplayWhitelisted(GURL("https://brave.com/")));
+}
+
 }  // namespace
@@ -0,0 +1,79 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_referrals/browser/referral_headers_index.h"
+
+#include "base/logging.h"
+#include "base/strings/string_util.h"
+#include "base/values.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+ReferralHeadersIndex::ReferralHeadersIndex() {
+}
+
+ReferralHeadersIndex::~ReferralHeadersIndex() {
+}
+
+// static
+scoped_refptr<const ReferralHeadersIndex> ReferralHeadersIndex::Create(
+    const base::ListValue& referral_headers_list) {
+  scoped_refptr<ReferralHeadersIndex> index(new ReferralHeadersIndex());
+  for (const auto& headers_value : referral_headers_list) {
+    const base::Value* domains_list =
+        headers_value.FindKeyOfType("domains", base::Value::Type::LIST);
+    if (!domains_list) {
+      LOG(WARNING) << "Failed to retrieve 'domains' key from referral headers";
+      continue;
+    }
+    const base::Value* headers_dict =
+        headers_value.FindKeyOfType("headers", base::Value::Type::DICTIONARY);
+    if (!headers_dict) {
+      LOG(WARNING) << "Failed to retrieve 'headers' key from referral headers";
+      continue;
+    }
+
+    Headers headers;
+    for (const auto& it : headers_dict->DictItems()) {
+      if (it.second.is_string())
+        headers.emplace_back(it.first, it.second.GetString());
+    }
+    const size_t headers_index = index->headers_.size();
+    index->headers_.push_back(std::move(headers));
+
+    for (const auto& domain_value : domains_list->GetList()) {
+      if (!domain_value.is_string() || domain_value.GetString().empty())
+        continue;
+      // Earlier entries take precedence, so don't overwrite.
+      index->domains_.emplace(base::ToLowerASCII(domain_value.GetString()),
+                              headers_index);
+    }
+  }
+  return index;
+}
+
+const ReferralHeadersIndex::Headers* ReferralHeadersIndex::GetMatchingHeaders(
+    const GURL& url) const {
+  if (domains_.empty() || !url.SchemeIsHTTPOrHTTPS())
+    return nullptr;
+
+  // Probe the host and each of its parent domains, keeping the match from the
+  // earliest list entry.
+  const std::string& host = url.host();
+  size_t best = headers_.size();
+  size_t pos = 0;
+  while (true) {
+    auto it = domains_.find(host.substr(pos));
+    if (it != domains_.end() && it->second < best)
+      best = it->second;
+    pos = host.find('.', pos);
+    if (pos == std::string::npos)
+      break;
+    ++pos;
+  }
+  return best < headers_.size() ? &headers_[best] : nullptr;
+}
+
+}  // namespace brave
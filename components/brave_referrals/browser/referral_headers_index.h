@@ -0,0 +1,57 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REFERRALS_BROWSER_REFERRAL_HEADERS_INDEX_H_
+#define BRAVE_COMPONENTS_BRAVE_REFERRALS_BROWSER_REFERRAL_HEADERS_INDEX_H_
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/memory/ref_counted.h"
+
+class GURL;
+
+namespace base {
+class ListValue;
+}
+
+namespace brave {
+
+// Compiled form of the referral headers list (see kReferralHeaders): each
+// partner domain maps to the headers to add to http(s) requests for that
+// domain or any of its subdomains, so matching a request is a few hash
+// lookups on its host instead of a walk over the list value. Immutable once
+// created, so a snapshot can be shared across threads and each request keeps
+// a reference to the one it started with while a newer one is swapped in.
+class ReferralHeadersIndex
+    : public base::RefCountedThreadSafe<ReferralHeadersIndex> {
+ public:
+  using Headers = std::vector<std::pair<std::string, std::string>>;
+
+  static scoped_refptr<const ReferralHeadersIndex> Create(
+      const base::ListValue& referral_headers_list);
+
+  // Returns the headers of the first list entry with a domain matching |url|,
+  // or nullptr if there is none.
+  const Headers* GetMatchingHeaders(const GURL& url) const;
+
+ private:
+  friend class base::RefCountedThreadSafe<ReferralHeadersIndex>;
+
+  ReferralHeadersIndex();
+  ~ReferralHeadersIndex();
+
+  std::vector<Headers> headers_;
+  // domain -> index in |headers_| of the first entry listing that domain.
+  std::unordered_map<std::string, size_t> domains_;
+
+  DISALLOW_COPY_AND_ASSIGN(ReferralHeadersIndex);
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REFERRALS_BROWSER_REFERRAL_HEADERS_INDEX_H_
@@ -0,0 +1,63 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/ledger_timer_queue.h"
+
+#include <algorithm>
+
+#include "base/bind.h"
+
+namespace brave_rewards {
+
+namespace {
+
+// Ledger timers are set in whole seconds, so firing one up to a second
+// early is within their precision.
+constexpr base::TimeDelta kSlack = base::TimeDelta::FromSeconds(1);
+
+}  // namespace
+
+LedgerTimerQueue::LedgerTimerQueue(const FireCallback& callback)
+    : callback_(callback) {
+}
+
+LedgerTimerQueue::~LedgerTimerQueue() {
+}
+
+void LedgerTimerQueue::Add(uint32_t timer_id, base::TimeDelta delay) {
+  timers_.push(Entry(base::TimeTicks::Now() + delay, timer_id));
+  Reschedule();
+}
+
+void LedgerTimerQueue::OnTimer() {
+  const base::TimeTicks fire_before = base::TimeTicks::Now() + kSlack;
+  std::vector<uint32_t> due;
+  while (!timers_.empty() && timers_.top().first <= fire_before) {
+    due.push_back(timers_.top().second);
+    timers_.pop();
+  }
+
+  // The ledger may set new timers while handling these.
+  Reschedule();
+  for (uint32_t timer_id : due)
+    callback_.Run(timer_id);
+}
+
+void LedgerTimerQueue::Reschedule() {
+  if (timers_.empty()) {
+    timer_.Stop();
+    return;
+  }
+
+  const base::TimeTicks next = timers_.top().first;
+  if (timer_.IsRunning() && scheduled_time_ <= next)
+    return;
+
+  scheduled_time_ = next;
+  timer_.Start(FROM_HERE,
+      std::max(next - base::TimeTicks::Now(), base::TimeDelta()),
+      base::Bind(&LedgerTimerQueue::OnTimer, base::Unretained(this)));
+}
+
+}  // namespace brave_rewards
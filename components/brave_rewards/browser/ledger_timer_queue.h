@@ -0,0 +1,58 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_LEDGER_TIMER_QUEUE_H_
+#define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_LEDGER_TIMER_QUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+
+namespace brave_rewards {
+
+// Schedules the ledger's timers on a min-heap of deadlines behind a single
+// OneShotTimer that is armed for the earliest one. When it fires, every
+// timer due within kSlack is fired with it, so timers set a few moments
+// apart cost one wakeup instead of one each.
+class LedgerTimerQueue {
+ public:
+  using FireCallback = base::RepeatingCallback<void(uint32_t timer_id)>;
+
+  explicit LedgerTimerQueue(const FireCallback& callback);
+  ~LedgerTimerQueue();
+
+  void Add(uint32_t timer_id, base::TimeDelta delay);
+
+  bool empty() const { return timers_.empty(); }
+  size_t size() const { return timers_.size(); }
+
+ private:
+  // (deadline, timer id); ids break ties so timers due at the same time
+  // fire in the order they were set.
+  using Entry = std::pair<base::TimeTicks, uint32_t>;
+
+  void OnTimer();
+  void Reschedule();
+
+  FireCallback callback_;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> timers_;
+  base::OneShotTimer timer_;
+  // Deadline |timer_| is armed for, if it is running.
+  base::TimeTicks scheduled_time_;
+
+  DISALLOW_COPY_AND_ASSIGN(LedgerTimerQueue);
+};
+
+}  // namespace brave_rewards
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_LEDGER_TIMER_QUEUE_H_
@@ -0,0 +1,61 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/ledger_timer_queue.h"
+
+#include <vector>
+
+#include "base/bind.h"
+#include "base/test/scoped_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+using brave_rewards::LedgerTimerQueue;
+
+class LedgerTimerQueueTest : public testing::Test {
+ public:
+  LedgerTimerQueueTest()
+      : scoped_task_environment_(
+            base::test::ScopedTaskEnvironment::MainThreadType::MOCK_TIME),
+        queue_(base::BindRepeating(&LedgerTimerQueueTest::OnTimer,
+                                   base::Unretained(this))) {}
+
+ protected:
+  void OnTimer(uint32_t timer_id) { fired_.push_back(timer_id); }
+
+  base::test::ScopedTaskEnvironment scoped_task_environment_;
+  LedgerTimerQueue queue_;
+  std::vector<uint32_t> fired_;
+};
+
+TEST_F(LedgerTimerQueueTest, FiresInDeadlineOrder) {
+  queue_.Add(1, base::TimeDelta::FromSeconds(30));
+  queue_.Add(2, base::TimeDelta::FromSeconds(10));
+  queue_.Add(3, base::TimeDelta::FromSeconds(20));
+
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(15));
+  ASSERT_EQ(1u, fired_.size());
+  EXPECT_EQ(2u, fired_[0]);
+
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(20));
+  ASSERT_EQ(3u, fired_.size());
+  EXPECT_EQ(3u, fired_[1]);
+  EXPECT_EQ(1u, fired_[2]);
+  EXPECT_TRUE(queue_.empty());
+}
+
+TEST_F(LedgerTimerQueueTest, BatchesTimersWithinSlack) {
+  queue_.Add(1, base::TimeDelta::FromMilliseconds(10000));
+  queue_.Add(2, base::TimeDelta::FromMilliseconds(10500));
+  queue_.Add(3, base::TimeDelta::FromSeconds(12));
+
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(10));
+  ASSERT_EQ(2u, fired_.size());
+  EXPECT_EQ(1u, fired_[0]);
+  EXPECT_EQ(2u, fired_[1]);
+  EXPECT_EQ(1u, queue_.size());
+}
+
+}  // namespace
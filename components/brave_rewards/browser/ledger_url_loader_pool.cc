@@ -0,0 +1,281 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/ledger_url_loader_pool.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+#include "chrome/browser/browser_process.h"
+#include "chrome/browser/net/system_network_context_manager.h"
+#include "net/base/load_flags.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_response_headers.h"
+#include "net/traffic_annotation/network_traffic_annotation.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/resource_response.h"
+#include "services/network/public/cpp/simple_url_loader.h"
+#include "services/network/public/cpp/simple_url_loader_stream_consumer.h"
+#include "url/gurl.h"
+
+namespace brave_rewards {
+
+namespace {
+
+// Reconcile bursts used to open dozens of parallel fetches.
+const size_t kMaxActiveRequests = 6;
+
+const int kMaxRetries = 3;
+
+// Doubled after every failed attempt.
+constexpr base::TimeDelta kInitialRetryDelay =
+    base::TimeDelta::FromSeconds(1);
+
+const char kGetMethod[] = "GET";
+
+net::NetworkTrafficAnnotationTag GetTrafficAnnotation() {
+  return net::DefineNetworkTrafficAnnotation("brave_rewards_ledger", R"(
+      semantics {
+        sender:
+          "Brave Rewards"
+        description:
+          "Requests made by the rewards ledger to create and restore the "
+          "wallet, fetch its balance and grants, and reconcile "
+          "contributions to publishers."
+        trigger:
+          "Brave Rewards is enabled, or the user acts on the rewards page."
+        data: "Ledger wallet and contribution data."
+        destination: WEBSITE
+      }
+      policy {
+        cookies_allowed: NO
+        setting:
+          "Brave Rewards can be disabled on the rewards page."
+        policy_exception_justification:
+          "Not implemented."
+      })");
+}
+
+bool IsSameRequest(const LedgerURLLoaderPool::Request& a,
+                   const LedgerURLLoaderPool::Request& b) {
+  return a.method == b.method && a.url == b.url && a.headers == b.headers &&
+      a.content == b.content && a.content_type == b.content_type;
+}
+
+}  // namespace
+
+struct LedgerURLLoaderPool::Job
+    : public network::SimpleURLLoaderStreamConsumer {
+  explicit Job(LedgerURLLoaderPool* pool) : pool(pool) {}
+
+  // network::SimpleURLLoaderStreamConsumer, for responses allowed to be
+  // larger than DownloadToString() can hold.
+  void OnDataReceived(base::StringPiece string_piece,
+                      base::OnceClosure resume) override {
+    if (string_piece.size() > request.max_response_size - body.size()) {
+      // Same error DownloadToString() fails with. Destroys |loader|.
+      pool->OnJobComplete(this, net::ERR_INSUFFICIENT_RESOURCES, nullptr);
+      return;
+    }
+    string_piece.AppendToString(&body);
+    std::move(resume).Run();
+  }
+
+  void OnComplete(bool success) override {
+    std::unique_ptr<std::string> response_body;
+    if (success)
+      response_body = std::make_unique<std::string>(std::move(body));
+    pool->OnJobComplete(this, loader->NetError(), std::move(response_body));
+  }
+
+  void OnRetry(base::OnceClosure start_retry) override {
+    // The pool retries on its own.
+    NOTREACHED();
+  }
+
+  LedgerURLLoaderPool* pool;
+  Request request;
+  // Everyone waiting for the response of |request|.
+  std::vector<ResponseCallback> callbacks;
+  std::unique_ptr<network::SimpleURLLoader> loader;
+  // The response read so far when streaming.
+  std::string body;
+  int retries = 0;
+};
+
+LedgerURLLoaderPool::Request::Request()
+    : max_response_size(
+          network::SimpleURLLoader::kMaxBoundedStringDownloadSize) {
+}
+
+LedgerURLLoaderPool::Request::Request(const Request& other) = default;
+
+LedgerURLLoaderPool::Request::~Request() {
+}
+
+LedgerURLLoaderPool::LedgerURLLoaderPool()
+    : url_loader_factory_for_testing_(nullptr),
+      weak_factory_(this) {
+}
+
+LedgerURLLoaderPool::~LedgerURLLoaderPool() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+}
+
+void LedgerURLLoaderPool::Fetch(const Request& request,
+                                const ResponseCallback& callback) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  Job* job = FindCoalescableJob(request);
+  if (job) {
+    job->callbacks.push_back(callback);
+    return;
+  }
+
+  std::unique_ptr<Job> new_job(new Job(this));
+  new_job->request = request;
+  new_job->callbacks.push_back(callback);
+  pending_jobs_.push_back(std::move(new_job));
+  StartPendingJobs();
+}
+
+void LedgerURLLoaderPool::SetURLLoaderFactoryForTesting(
+    network::mojom::URLLoaderFactory* url_loader_factory) {
+  url_loader_factory_for_testing_ = url_loader_factory;
+}
+
+LedgerURLLoaderPool::Job* LedgerURLLoaderPool::FindCoalescableJob(
+    const Request& request) {
+  // Only GETs are safe to answer with another caller's response.
+  if (request.method != kGetMethod)
+    return nullptr;
+
+  for (JobList* jobs : {&active_jobs_, &pending_jobs_}) {
+    for (const auto& job : *jobs) {
+      if (IsSameRequest(job->request, request))
+        return job.get();
+    }
+  }
+  return nullptr;
+}
+
+void LedgerURLLoaderPool::StartPendingJobs() {
+  while (!pending_jobs_.empty() && active_jobs_.size() < kMaxActiveRequests) {
+    active_jobs_.splice(active_jobs_.end(), pending_jobs_,
+                        pending_jobs_.begin());
+    StartJob(active_jobs_.back().get());
+  }
+}
+
+void LedgerURLLoaderPool::StartJob(Job* job) {
+  const Request& request = job->request;
+
+  auto resource_request = std::make_unique<network::ResourceRequest>();
+  resource_request->url = GURL(request.url);
+  resource_request->method = request.method;
+  resource_request->load_flags =
+      net::LOAD_DO_NOT_SEND_COOKIES | net::LOAD_DO_NOT_SAVE_COOKIES |
+      net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE |
+      net::LOAD_DO_NOT_SEND_AUTH_DATA;
+  for (const auto& header : request.headers)
+    resource_request->headers.AddHeaderFromString(header);
+
+  job->loader = network::SimpleURLLoader::Create(
+      std::move(resource_request), GetTrafficAnnotation());
+  // The ledger reads the body of error responses too.
+  job->loader->SetAllowHttpErrorResults(true);
+  if (!request.content.empty())
+    job->loader->AttachStringForUpload(request.content, request.content_type);
+  if (request.max_response_size <=
+      network::SimpleURLLoader::kMaxBoundedStringDownloadSize) {
+    job->loader->DownloadToString(
+        GetURLLoaderFactory(),
+        base::BindOnce(&LedgerURLLoaderPool::OnJobDownloaded,
+                       base::Unretained(this), job),
+        request.max_response_size);
+    return;
+  }
+
+  job->body.clear();
+  job->loader->DownloadAsStream(GetURLLoaderFactory(), job);
+}
+
+void LedgerURLLoaderPool::OnJobDownloaded(
+    Job* job,
+    std::unique_ptr<std::string> response_body) {
+  OnJobComplete(job, job->loader->NetError(), std::move(response_body));
+}
+
+void LedgerURLLoaderPool::OnJobComplete(
+    Job* job,
+    int net_error,
+    std::unique_ptr<std::string> response_body) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  auto it = active_jobs_.begin();
+  while (it != active_jobs_.end() && it->get() != job)
+    ++it;
+  DCHECK(it != active_jobs_.end());
+
+  int response_code = -1;
+  std::map<std::string, std::string> headers;
+  const network::ResourceResponseHead* response_info =
+      job->loader->ResponseInfo();
+  if (response_info && response_info->headers) {
+    response_code = response_info->headers->response_code();
+    size_t iter = 0;
+    std::string key;
+    std::string value;
+    while (response_info->headers->EnumerateHeaderLines(&iter, &key,
+                                                        &value)) {
+      headers[base::ToLowerASCII(key)] = value;
+    }
+  }
+
+  // Don't hand the ledger a success code with a missing or cut off body.
+  if (net_error != net::OK)
+    response_code = -1;
+
+  // An oversized response would only be too large again.
+  const bool failed =
+      (net_error != net::OK && net_error != net::ERR_INSUFFICIENT_RESOURCES) ||
+      response_code >= 500;
+  if (failed && job->request.method == kGetMethod &&
+      job->retries < kMaxRetries) {
+    // Keep the slot while backing off so a struggling server does not get
+    // the next requests right away.
+    job->loader.reset();
+    base::SequencedTaskRunnerHandle::Get()->PostDelayedTask(FROM_HERE,
+        base::BindOnce(&LedgerURLLoaderPool::RetryJob,
+                       weak_factory_.GetWeakPtr(), job),
+        kInitialRetryDelay * (1 << job->retries));
+    ++job->retries;
+    return;
+  }
+
+  std::unique_ptr<Job> done = std::move(*it);
+  active_jobs_.erase(it);
+  StartPendingJobs();
+
+  const std::string body = response_body ? *response_body : std::string();
+  for (const auto& callback : done->callbacks)
+    callback.Run(response_code, body, headers);
+}
+
+void LedgerURLLoaderPool::RetryJob(Job* job) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  // |job| stays in |active_jobs_| until it completes, and the weak pointer
+  // this was posted with keeps it from outliving the pool.
+  StartJob(job);
+}
+
+network::mojom::URLLoaderFactory* LedgerURLLoaderPool::GetURLLoaderFactory() {
+  if (url_loader_factory_for_testing_)
+    return url_loader_factory_for_testing_;
+  return g_browser_process->system_network_context_manager()
+      ->GetURLLoaderFactory();
+}
+
+}  // namespace brave_rewards
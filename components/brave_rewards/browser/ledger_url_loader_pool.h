@@ -0,0 +1,97 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_LEDGER_URL_LOADER_POOL_H_
+#define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_LEDGER_URL_LOADER_POOL_H_
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/memory/weak_ptr.h"
+#include "base/sequence_checker.h"
+
+namespace network {
+class SimpleURLLoader;
+namespace mojom {
+class URLLoaderFactory;
+}  // namespace mojom
+}  // namespace network
+
+namespace brave_rewards {
+
+// Runs the ledger's network requests through SimpleURLLoader. At most
+// kMaxActiveRequests requests are in flight, the rest wait in FIFO order.
+// Identical GETs that overlap share a single fetch, and GETs that fail with
+// a network error or a 5xx are retried with exponential backoff. Responses
+// larger than the request's max_response_size fail with response code -1.
+class LedgerURLLoaderPool {
+ public:
+  using ResponseCallback = base::Callback<void(
+      int response_code,
+      const std::string& body,
+      const std::map<std::string, std::string>& headers)>;
+
+  struct Request {
+    Request();
+    Request(const Request& other);
+    ~Request();
+
+    std::string url;
+    std::string method;
+    std::vector<std::string> headers;
+    std::string content;
+    std::string content_type;
+    // Defaults to the most SimpleURLLoader::DownloadToString() can hold.
+    // Larger limits are read as a stream.
+    size_t max_response_size;
+  };
+
+  LedgerURLLoaderPool();
+  ~LedgerURLLoaderPool();
+
+  void Fetch(const Request& request, const ResponseCallback& callback);
+
+  // Lets tests answer requests with a network::TestURLLoaderFactory.
+  void SetURLLoaderFactoryForTesting(
+      network::mojom::URLLoaderFactory* url_loader_factory);
+
+  base::WeakPtr<LedgerURLLoaderPool> AsWeakPtr() {
+    return weak_factory_.GetWeakPtr();
+  }
+
+ private:
+  struct Job;
+  using JobList = std::list<std::unique_ptr<Job>>;
+
+  Job* FindCoalescableJob(const Request& request);
+  void StartPendingJobs();
+  void StartJob(Job* job);
+  void OnJobDownloaded(Job* job, std::unique_ptr<std::string> response_body);
+  void OnJobComplete(Job* job,
+                     int net_error,
+                     std::unique_ptr<std::string> response_body);
+  void RetryJob(Job* job);
+  network::mojom::URLLoaderFactory* GetURLLoaderFactory();
+
+  // Jobs that wait for a free slot, oldest first.
+  JobList pending_jobs_;
+  // Jobs that are being fetched or wait for their backoff to expire. Both
+  // count against kMaxActiveRequests.
+  JobList active_jobs_;
+  network::mojom::URLLoaderFactory* url_loader_factory_for_testing_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+  base::WeakPtrFactory<LedgerURLLoaderPool> weak_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(LedgerURLLoaderPool);
+};
+
+}  // namespace brave_rewards
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_LEDGER_URL_LOADER_POOL_H_
@@ -0,0 +1,225 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/ledger_url_loader_pool.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/test/scoped_task_environment.h"
+#include "base/time/time.h"
+#include "net/http/http_status_code.h"
+#include "services/network/public/cpp/simple_url_loader.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+using brave_rewards::LedgerURLLoaderPool;
+
+const char kBalanceURL[] =
+    "https://ledger.mercury.basicattentiontoken.org/v2/wallet/balance";
+
+std::string NumberedURL(int i) {
+  return std::string(kBalanceURL) + "?i=" + base::IntToString(i);
+}
+
+class LedgerURLLoaderPoolTest : public testing::Test {
+ public:
+  LedgerURLLoaderPoolTest()
+      : scoped_task_environment_(
+            base::test::ScopedTaskEnvironment::MainThreadType::MOCK_TIME),
+        requests_seen_(0) {
+    test_url_loader_factory_.SetInterceptor(
+        base::BindRepeating(&LedgerURLLoaderPoolTest::OnRequest,
+                            base::Unretained(this)));
+    pool_.SetURLLoaderFactoryForTesting(&test_url_loader_factory_);
+  }
+
+  LedgerURLLoaderPool::ResponseCallback ResponseCallback() {
+    return base::Bind(&LedgerURLLoaderPoolTest::OnResponse,
+                      base::Unretained(this));
+  }
+
+  LedgerURLLoaderPool::Request MakeRequest(const std::string& url,
+                                           const std::string& method) {
+    LedgerURLLoaderPool::Request request;
+    request.url = url;
+    request.method = method;
+    return request;
+  }
+
+ protected:
+  void OnRequest(const network::ResourceRequest& request) {
+    ++requests_seen_;
+  }
+
+  void OnResponse(int response_code,
+                  const std::string& body,
+                  const std::map<std::string, std::string>& headers) {
+    response_codes_.push_back(response_code);
+    bodies_.push_back(body);
+  }
+
+  base::test::ScopedTaskEnvironment scoped_task_environment_;
+  network::TestURLLoaderFactory test_url_loader_factory_;
+  LedgerURLLoaderPool pool_;
+  int requests_seen_;
+  std::vector<int> response_codes_;
+  std::vector<std::string> bodies_;
+};
+
+TEST_F(LedgerURLLoaderPoolTest, CoalescesIdenticalGets) {
+  test_url_loader_factory_.AddResponse(kBalanceURL, "{\"balance\":\"5\"}");
+
+  pool_.Fetch(MakeRequest(kBalanceURL, "GET"), ResponseCallback());
+  pool_.Fetch(MakeRequest(kBalanceURL, "GET"), ResponseCallback());
+  scoped_task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(1, requests_seen_);
+  ASSERT_EQ(2u, response_codes_.size());
+  EXPECT_EQ(200, response_codes_[0]);
+  EXPECT_EQ(200, response_codes_[1]);
+  EXPECT_EQ("{\"balance\":\"5\"}", bodies_[0]);
+  EXPECT_EQ(bodies_[0], bodies_[1]);
+}
+
+TEST_F(LedgerURLLoaderPoolTest, DoesNotCoalescePosts) {
+  test_url_loader_factory_.AddResponse(kBalanceURL, std::string());
+
+  pool_.Fetch(MakeRequest(kBalanceURL, "POST"), ResponseCallback());
+  pool_.Fetch(MakeRequest(kBalanceURL, "POST"), ResponseCallback());
+  scoped_task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(2, requests_seen_);
+  EXPECT_EQ(2u, response_codes_.size());
+}
+
+TEST_F(LedgerURLLoaderPoolTest, LimitsActiveRequests) {
+  for (int i = 0; i < 10; ++i) {
+    pool_.Fetch(MakeRequest(NumberedURL(i), "GET"), ResponseCallback());
+  }
+  scoped_task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(6, requests_seen_);
+  EXPECT_EQ(6, test_url_loader_factory_.NumPending());
+  EXPECT_TRUE(response_codes_.empty());
+}
+
+TEST_F(LedgerURLLoaderPoolTest, RetriesServerErrorsWithBackoff) {
+  test_url_loader_factory_.AddResponse(kBalanceURL, "down",
+                                       net::HTTP_SERVICE_UNAVAILABLE);
+
+  pool_.Fetch(MakeRequest(kBalanceURL, "GET"), ResponseCallback());
+  scoped_task_environment_.RunUntilIdle();
+  EXPECT_EQ(1, requests_seen_);
+
+  // Retried after 1s, 2s and 4s.
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(1));
+  EXPECT_EQ(2, requests_seen_);
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(1));
+  EXPECT_EQ(2, requests_seen_);
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(1));
+  EXPECT_EQ(3, requests_seen_);
+  EXPECT_TRUE(response_codes_.empty());
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(4));
+  EXPECT_EQ(4, requests_seen_);
+
+  // Then the last error is handed to the ledger.
+  ASSERT_EQ(1u, response_codes_.size());
+  EXPECT_EQ(net::HTTP_SERVICE_UNAVAILABLE, response_codes_[0]);
+  EXPECT_EQ("down", bodies_[0]);
+
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromMinutes(1));
+  EXPECT_EQ(4, requests_seen_);
+}
+
+TEST_F(LedgerURLLoaderPoolTest, DoesNotRetryPosts) {
+  test_url_loader_factory_.AddResponse(kBalanceURL, std::string(),
+                                       net::HTTP_SERVICE_UNAVAILABLE);
+
+  pool_.Fetch(MakeRequest(kBalanceURL, "POST"), ResponseCallback());
+  scoped_task_environment_.RunUntilIdle();
+  ASSERT_EQ(1u, response_codes_.size());
+  EXPECT_EQ(net::HTTP_SERVICE_UNAVAILABLE, response_codes_[0]);
+
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromMinutes(1));
+  EXPECT_EQ(1, requests_seen_);
+}
+
+TEST_F(LedgerURLLoaderPoolTest, BackoffKeepsSlot) {
+  for (int i = 0; i < 6; ++i) {
+    test_url_loader_factory_.AddResponse(NumberedURL(i), std::string(),
+                                         net::HTTP_INTERNAL_SERVER_ERROR);
+    pool_.Fetch(MakeRequest(NumberedURL(i), "GET"), ResponseCallback());
+  }
+  test_url_loader_factory_.AddResponse(NumberedURL(6), "ok");
+  pool_.Fetch(MakeRequest(NumberedURL(6), "GET"), ResponseCallback());
+  scoped_task_environment_.RunUntilIdle();
+
+  // Every slot is held by a job waiting to retry.
+  EXPECT_EQ(6, requests_seen_);
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(6));
+  EXPECT_EQ(6 * 3, requests_seen_);
+  EXPECT_TRUE(response_codes_.empty());
+
+  // The last retries give up and free the slots.
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(1));
+  EXPECT_EQ(6 * 4 + 1, requests_seen_);
+  ASSERT_EQ(7u, response_codes_.size());
+  EXPECT_EQ(6, std::count(response_codes_.begin(), response_codes_.end(),
+                          net::HTTP_INTERNAL_SERVER_ERROR));
+  EXPECT_EQ(1, std::count(bodies_.begin(), bodies_.end(), "ok"));
+}
+
+TEST_F(LedgerURLLoaderPoolTest, OversizedResponseFails) {
+  test_url_loader_factory_.AddResponse(kBalanceURL, "12345");
+
+  LedgerURLLoaderPool::Request request = MakeRequest(kBalanceURL, "GET");
+  request.max_response_size = 4;
+  pool_.Fetch(request, ResponseCallback());
+  scoped_task_environment_.RunUntilIdle();
+
+  ASSERT_EQ(1u, response_codes_.size());
+  EXPECT_EQ(-1, response_codes_[0]);
+  EXPECT_EQ(std::string(), bodies_[0]);
+
+  // Not retried, it would only be too large again.
+  scoped_task_environment_.FastForwardBy(base::TimeDelta::FromMinutes(1));
+  EXPECT_EQ(1, requests_seen_);
+}
+
+TEST_F(LedgerURLLoaderPoolTest, StreamsResponsesAboveStringLimit) {
+  const size_t max_size =
+      network::SimpleURLLoader::kMaxBoundedStringDownloadSize * 2;
+  const std::string large_body(
+      network::SimpleURLLoader::kMaxBoundedStringDownloadSize + 1, 'a');
+  test_url_loader_factory_.AddResponse(NumberedURL(0), large_body);
+  test_url_loader_factory_.AddResponse(NumberedURL(1),
+                                       std::string(max_size + 1, 'a'));
+
+  LedgerURLLoaderPool::Request request = MakeRequest(NumberedURL(0), "GET");
+  request.max_response_size = max_size;
+  pool_.Fetch(request, ResponseCallback());
+  scoped_task_environment_.RunUntilIdle();
+
+  ASSERT_EQ(1u, response_codes_.size());
+  EXPECT_EQ(200, response_codes_[0]);
+  EXPECT_EQ(large_body, bodies_[0]);
+
+  request.url = NumberedURL(1);
+  pool_.Fetch(request, ResponseCallback());
+  scoped_task_environment_.RunUntilIdle();
+
+  ASSERT_EQ(2u, response_codes_.size());
+  EXPECT_EQ(-1, response_codes_[1]);
+  EXPECT_EQ(std::string(), bodies_[1]);
+  EXPECT_EQ(2, requests_seen_);
+}
+
+}  // namespace
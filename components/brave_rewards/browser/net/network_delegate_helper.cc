@@ -4,6 +4,11 @@
 
 #include "brave/components/brave_rewards/browser/net/network_delegate_helper.h"
 
+#include <string>
+#include <utility>
+
+#include "base/containers/flat_set.h"
+#include "base/strings/string_piece.h"
 #include "base/task/post_task.h"
 #include "brave/components/brave_rewards/browser/rewards_service.h"
 #include "brave/components/brave_rewards/browser/rewards_service_factory.h"
@@ -19,11 +24,51 @@
 #include "net/base/upload_data_stream.h"
 #include "net/url_request/url_request.h"
 #include "url/gurl.h"
+#include "url/third_party/mozilla/url_parse.h"
 
 namespace brave_rewards {
 
 namespace {
 
+// Domains of the media providers ledger::Ledger::IsMediaLink() knows about
+// (YouTube and Twitch). A request can only be a media link when its URL,
+// first party or referrer is on one of them.
+bool IsMediaHost(base::StringPiece host) {
+  static const base::flat_set<base::StringPiece> kMediaDomains({
+    "youtube.com",
+    "twitch.tv",
+    "ttvnw.net",
+  });
+
+  size_t pos = 0;
+  while (true) {
+    if (kMediaDomains.count(host.substr(pos)))
+      return true;
+    pos = host.find('.', pos);
+    if (pos == base::StringPiece::npos)
+      return false;
+    ++pos;
+  }
+}
+
+// Cheap check that runs before building the strings IsMediaLink() needs.
+bool MayBeMediaLink(const GURL& url,
+                    const GURL& first_party_url,
+                    const std::string& referrer) {
+  if (IsMediaHost(url.host_piece()) ||
+      IsMediaHost(first_party_url.host_piece()))
+    return true;
+
+  // The referrer is already a canonical spec; find its host without
+  // parsing it into a GURL.
+  url::Parsed parsed;
+  url::ParseStandardURL(referrer.data(), referrer.length(), &parsed);
+  if (!parsed.host.is_nonempty())
+    return false;
+  return IsMediaHost(base::StringPiece(referrer.data() + parsed.host.begin,
+                                       parsed.host.len));
+}
+
 bool GetPostData(const net::URLRequest* request, std::string* post_data) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
   if (!request->has_upload())
@@ -38,14 +83,21 @@ bool GetPostData(const net::URLRequest* request, std::string* post_data) {
   if (element_readers->empty())
     return false;
 
-  post_data->clear();
+  // Size the body up front so it is gathered with a single allocation.
+  size_t length = 0;
   for (const auto& element_reader : *element_readers) {
     const net::UploadBytesElementReader* reader =
         element_reader->AsBytesReader();
-    if (!reader) {
-      post_data->clear();
+    if (!reader)
       return false;
-    }
+    length += reader->length();
+  }
+
+  post_data->clear();
+  post_data->reserve(length);
+  for (const auto& element_reader : *element_readers) {
+    const net::UploadBytesElementReader* reader =
+        element_reader->AsBytesReader();
     post_data->append(reader->bytes(), reader->length());
   }
   return true;
@@ -96,10 +148,10 @@ content::WebContents* GetWebContents(
 }
 
 void DispatchOnUI(
-    const std::string post_data,
-    const GURL url,
-    const GURL first_party_url,
-    const std::string referrer,
+    std::string post_data,
+    const GURL& url,
+    const GURL& first_party_url,
+    const std::string& referrer,
     int render_process_id,
     int render_frame_id,
     int frame_tree_node_id) {
@@ -129,7 +181,10 @@ int OnBeforeURLRequest(
   std::shared_ptr<brave::BraveRequestInfo> ctx) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
 
-  if (IsMediaLink(ctx->request_url,
+  if (MayBeMediaLink(ctx->request_url,
+                     ctx->request->site_for_cookies(),
+                     ctx->request->referrer()) &&
+      IsMediaLink(ctx->request_url,
                   ctx->request->site_for_cookies(),
                   GURL(ctx->request->referrer()))) {
     std::string post_data;
@@ -137,9 +192,10 @@ int OnBeforeURLRequest(
       int render_process_id, render_frame_id, frame_tree_node_id;
       GetRenderFrameInfo(ctx->request, &render_frame_id, &render_process_id,
           &frame_tree_node_id);
+      // The body is moved into the task rather than copied again.
       base::PostTaskWithTraits(FROM_HERE, {content::BrowserThread::UI},
           base::BindOnce(&DispatchOnUI,
-              post_data,
+              std::move(post_data),
               ctx->request_url, ctx->request->site_for_cookies(), ctx->request->referrer(),
               render_process_id, render_frame_id, frame_tree_node_id));
     }
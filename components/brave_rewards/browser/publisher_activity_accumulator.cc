@@ -0,0 +1,114 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/publisher_activity_accumulator.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace brave_rewards {
+
+PublisherActivityAccumulator::PublisherActivityAccumulator() {
+}
+
+PublisherActivityAccumulator::~PublisherActivityAccumulator() {
+}
+
+// static
+bool PublisherActivityAccumulator::IsSameActivity(
+    const ledger::PublisherInfo& a,
+    const ledger::PublisherInfo& b) {
+  return a.id == b.id &&
+      a.category == b.category &&
+      a.month == b.month &&
+      a.year == b.year &&
+      a.reconcile_stamp == b.reconcile_stamp;
+}
+
+void PublisherActivityAccumulator::Add(const ledger::PublisherInfo& info) {
+  // Move the entry to the back so the publisher_info columns (name,
+  // excluded, ...) end up with the values of the most recent save.
+  for (auto it = pending_.begin(); it != pending_.end(); ++it) {
+    if (IsSameActivity(*it, info)) {
+      pending_.erase(it);
+      break;
+    }
+  }
+  pending_.push_back(info);
+}
+
+void PublisherActivityAccumulator::Restore(
+    const ledger::PublisherInfoList& list) {
+  ledger::PublisherInfoList restored;
+  for (const auto& info : list) {
+    auto is_same_activity = [&info](const ledger::PublisherInfo& pending) {
+      return IsSameActivity(pending, info);
+    };
+    if (std::none_of(pending_.begin(), pending_.end(), is_same_activity))
+      restored.push_back(info);
+  }
+  pending_.insert(pending_.begin(), restored.begin(), restored.end());
+}
+
+bool PublisherActivityAccumulator::Find(
+    const ledger::PublisherInfoFilter& filter,
+    ledger::PublisherInfo* info) const {
+  // Anything less specific can match rows that are only in the database.
+  if (filter.id.empty() ||
+      filter.category == ledger::PUBLISHER_CATEGORY::ALL_CATEGORIES ||
+      filter.month == ledger::PUBLISHER_MONTH::ANY ||
+      filter.year <= 0 ||
+      filter.reconcile_stamp <= 0)
+    return false;
+
+  const ledger::PublisherInfo* activity = nullptr;
+  const ledger::PublisherInfo* publisher = nullptr;
+  for (auto it = pending_.rbegin(); it != pending_.rend(); ++it) {
+    if (it->id != filter.id)
+      continue;
+    // The newest save for the id decides the publisher_info columns, even
+    // if it is for another activity row (e.g. an exclusion toggle).
+    if (!publisher)
+      publisher = &*it;
+    if (it->category == filter.category &&
+        it->month == filter.month &&
+        it->year == filter.year &&
+        it->reconcile_stamp == filter.reconcile_stamp) {
+      activity = &*it;
+      break;
+    }
+  }
+  if (!activity)
+    return false;
+
+  *info = *activity;
+  info->verified = publisher->verified;
+  info->excluded = publisher->excluded;
+  info->name = publisher->name;
+  info->url = publisher->url;
+  info->provider = publisher->provider;
+  info->favicon_url = publisher->favicon_url;
+
+  // Mirror the remaining conditions of PublisherInfoDatabase's clauses.
+  if (filter.min_duration > 0 && info->duration < filter.min_duration)
+    return false;
+  if (filter.excluded ==
+      ledger::PUBLISHER_EXCLUDE_FILTER::FILTER_ALL_EXCEPT_EXCLUDED) {
+    if (info->excluded == ledger::PUBLISHER_EXCLUDE::EXCLUDED)
+      return false;
+  } else if (filter.excluded != ledger::PUBLISHER_EXCLUDE_FILTER::FILTER_ALL &&
+             static_cast<int>(info->excluded) !=
+                 static_cast<int>(filter.excluded)) {
+    return false;
+  }
+  return true;
+}
+
+ledger::PublisherInfoList PublisherActivityAccumulator::Take() {
+  ledger::PublisherInfoList list;
+  list.swap(pending_);
+  return list;
+}
+
+}  // namespace brave_rewards
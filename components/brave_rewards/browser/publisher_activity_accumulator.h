@@ -0,0 +1,54 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_PUBLISHER_ACTIVITY_ACCUMULATOR_H_
+#define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_PUBLISHER_ACTIVITY_ACCUMULATOR_H_
+
+#include <stddef.h>
+
+#include "base/macros.h"
+#include "bat/ledger/publisher_info.h"
+
+namespace brave_rewards {
+
+// Holds the publisher info the ledger saved since the last flush to
+// PublisherInfoDatabase. Entries are keyed by (publisher, category, month,
+// year, reconcile_stamp); the ledger always saves running totals, so a newer
+// save for a key replaces the pending one and only the latest is written.
+class PublisherActivityAccumulator {
+ public:
+  PublisherActivityAccumulator();
+  ~PublisherActivityAccumulator();
+
+  void Add(const ledger::PublisherInfo& info);
+
+  // Puts back entries handed out by Take() that could not be written. They
+  // go ahead of everything saved since, and entries superseded by a newer
+  // save are dropped.
+  void Restore(const ledger::PublisherInfoList& list);
+
+  // Sets |info| to what PublisherInfoDatabase::Find() would return for
+  // |filter| once flushed, when the filter selects exactly one pending
+  // activity row. Returns false when the database has to be consulted.
+  bool Find(const ledger::PublisherInfoFilter& filter,
+            ledger::PublisherInfo* info) const;
+
+  // Hands over the pending entries in the order they were last saved.
+  ledger::PublisherInfoList Take();
+
+  bool empty() const { return pending_.empty(); }
+  size_t size() const { return pending_.size(); }
+
+ private:
+  static bool IsSameActivity(const ledger::PublisherInfo& a,
+                             const ledger::PublisherInfo& b);
+
+  ledger::PublisherInfoList pending_;
+
+  DISALLOW_COPY_AND_ASSIGN(PublisherActivityAccumulator);
+};
+
+}  // namespace brave_rewards
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_PUBLISHER_ACTIVITY_ACCUMULATOR_H_
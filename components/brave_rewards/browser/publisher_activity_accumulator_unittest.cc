@@ -0,0 +1,121 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/publisher_activity_accumulator.h"
+
+#include <string>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+using brave_rewards::PublisherActivityAccumulator;
+
+const int kYear = 2019;
+const uint64_t kReconcileStamp = 1000;
+
+ledger::PublisherInfo MakePublisherInfo(const std::string& id,
+                                        uint64_t duration) {
+  ledger::PublisherInfo info(id, ledger::PUBLISHER_MONTH::JANUARY, kYear);
+  info.name = id;
+  info.category = ledger::PUBLISHER_CATEGORY::AUTO_CONTRIBUTE;
+  info.reconcile_stamp = kReconcileStamp;
+  info.duration = duration;
+  info.excluded = ledger::PUBLISHER_EXCLUDE::DEFAULT;
+  return info;
+}
+
+// The kind of save the ledger makes when the user toggles an exclusion.
+ledger::PublisherInfo MakeExclusion(const std::string& id,
+                                    ledger::PUBLISHER_EXCLUDE excluded) {
+  ledger::PublisherInfo info(id, ledger::PUBLISHER_MONTH::ANY, -1);
+  info.name = id;
+  info.excluded = excluded;
+  return info;
+}
+
+ledger::PublisherInfoFilter MakeFilter(const std::string& id) {
+  ledger::PublisherInfoFilter filter;
+  filter.id = id;
+  filter.category = ledger::PUBLISHER_CATEGORY::AUTO_CONTRIBUTE;
+  filter.month = ledger::PUBLISHER_MONTH::JANUARY;
+  filter.year = kYear;
+  filter.reconcile_stamp = kReconcileStamp;
+  filter.excluded = ledger::PUBLISHER_EXCLUDE_FILTER::FILTER_ALL;
+  return filter;
+}
+
+TEST(PublisherActivityAccumulatorTest, AddReplacesSameActivity) {
+  PublisherActivityAccumulator accumulator;
+  accumulator.Add(MakePublisherInfo("a.com", 10));
+  accumulator.Add(MakePublisherInfo("b.com", 10));
+  accumulator.Add(MakePublisherInfo("a.com", 20));
+  EXPECT_EQ(2u, accumulator.size());
+
+  ledger::PublisherInfoList list = accumulator.Take();
+  EXPECT_TRUE(accumulator.empty());
+  ASSERT_EQ(2u, list.size());
+  EXPECT_EQ("b.com", list[0].id);
+  EXPECT_EQ("a.com", list[1].id);
+  EXPECT_EQ(20u, list[1].duration);
+}
+
+TEST(PublisherActivityAccumulatorTest, FindMirrorsFilter) {
+  PublisherActivityAccumulator accumulator;
+  accumulator.Add(MakePublisherInfo("a.com", 10));
+
+  ledger::PublisherInfo info;
+  EXPECT_TRUE(accumulator.Find(MakeFilter("a.com"), &info));
+  EXPECT_EQ(10u, info.duration);
+
+  EXPECT_FALSE(accumulator.Find(MakeFilter("b.com"), &info));
+
+  ledger::PublisherInfoFilter filter = MakeFilter("a.com");
+  filter.min_duration = 20;
+  EXPECT_FALSE(accumulator.Find(filter, &info));
+
+  // Filters that can match rows only in the database are not answered.
+  filter = MakeFilter("a.com");
+  filter.month = ledger::PUBLISHER_MONTH::ANY;
+  EXPECT_FALSE(accumulator.Find(filter, &info));
+}
+
+TEST(PublisherActivityAccumulatorTest, FindUsesNewestPublisherFields) {
+  PublisherActivityAccumulator accumulator;
+  accumulator.Add(MakePublisherInfo("a.com", 10));
+  accumulator.Add(MakeExclusion("a.com", ledger::PUBLISHER_EXCLUDE::EXCLUDED));
+
+  ledger::PublisherInfo info;
+  ledger::PublisherInfoFilter filter = MakeFilter("a.com");
+  EXPECT_TRUE(accumulator.Find(filter, &info));
+  EXPECT_EQ(ledger::PUBLISHER_EXCLUDE::EXCLUDED, info.excluded);
+  EXPECT_EQ(10u, info.duration);
+
+  filter.excluded =
+      ledger::PUBLISHER_EXCLUDE_FILTER::FILTER_ALL_EXCEPT_EXCLUDED;
+  EXPECT_FALSE(accumulator.Find(filter, &info));
+
+  accumulator.Add(MakeExclusion("a.com", ledger::PUBLISHER_EXCLUDE::INCLUDED));
+  EXPECT_TRUE(accumulator.Find(filter, &info));
+  EXPECT_EQ(ledger::PUBLISHER_EXCLUDE::INCLUDED, info.excluded);
+}
+
+TEST(PublisherActivityAccumulatorTest, RestoreKeepsNewerSaves) {
+  PublisherActivityAccumulator accumulator;
+  accumulator.Add(MakePublisherInfo("a.com", 10));
+  accumulator.Add(MakePublisherInfo("b.com", 10));
+  ledger::PublisherInfoList failed = accumulator.Take();
+
+  accumulator.Add(MakePublisherInfo("a.com", 30));
+  accumulator.Restore(failed);
+
+  ledger::PublisherInfoList list = accumulator.Take();
+  ASSERT_EQ(2u, list.size());
+  EXPECT_EQ("b.com", list[0].id);
+  EXPECT_EQ(10u, list[0].duration);
+  EXPECT_EQ("a.com", list[1].id);
+  EXPECT_EQ(30u, list[1].duration);
+}
+
+}  // namespace
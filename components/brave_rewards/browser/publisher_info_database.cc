@@ -7,6 +7,7 @@
 #include <stdint.h>
 
 #include <string>
+#include <utility>
 
 #include "base/bind.h"
 #include "base/command_line.h"
@@ -22,9 +23,44 @@ namespace brave_rewards {
 
 namespace {
 
-const int kCurrentVersionNumber = 2;
+const int kCurrentVersionNumber = 3;
 const int kCompatibleVersionNumber = 1;
 
+// Columns are read by GetActivityInfo().
+const char kActivityInfoColumns[] =
+    "SELECT ai.publisher_id, ai.duration, ai.score, ai.percent, "
+    "ai.weight, pi.verified, pi.excluded, ai.category, ai.month, ai.year, pi.name, "
+    "pi.url, pi.provider, pi.favIcon, ai.reconcile_stamp";
+const char kActivityInfoTables[] =
+    " FROM activity_info AS ai "
+    "INNER JOIN publisher_info AS pi ON ai.publisher_id = pi.publisher_id "
+    "WHERE 1 = 1";
+
+ledger::PublisherInfo GetActivityInfo(sql::Statement& info_sql) {
+  std::string id(info_sql.ColumnString(0));
+  ledger::PUBLISHER_MONTH month(
+      static_cast<ledger::PUBLISHER_MONTH>(info_sql.ColumnInt(8)));
+  int year(info_sql.ColumnInt(9));
+
+  ledger::PublisherInfo info(id, month, year);
+  info.duration = info_sql.ColumnInt64(1);
+
+  info.score = info_sql.ColumnDouble(2);
+  info.percent = info_sql.ColumnInt64(3);
+  info.weight = info_sql.ColumnDouble(4);
+  info.verified = info_sql.ColumnBool(5);
+  info.name = info_sql.ColumnString(10);
+  info.url = info_sql.ColumnString(11);
+  info.provider = info_sql.ColumnString(12);
+  info.favicon_url = info_sql.ColumnString(13);
+  info.reconcile_stamp = info_sql.ColumnInt64(14);
+
+  info.excluded = static_cast<ledger::PUBLISHER_EXCLUDE>(info_sql.ColumnInt(6));
+  info.category =
+      static_cast<ledger::PUBLISHER_CATEGORY>(info_sql.ColumnInt(7));
+  return info;
+}
+
 }  // namespace
 
 PublisherInfoDatabase::PublisherInfoDatabase(const base::FilePath& db_path) :
@@ -68,6 +104,9 @@ bool PublisherInfoDatabase::Init() {
   if (version_status != sql::INIT_OK)
     return version_status;
 
+  // Needs the columns added by the migrations, so only after those ran.
+  CreateActivityInfoFilterIndex();
+
   if (!committer.Commit())
     return false;
 
@@ -174,6 +213,21 @@ bool PublisherInfoDatabase::CreateActivityInfoIndex() {
       "ON activity_info (publisher_id)");
 }
 
+bool PublisherInfoDatabase::CreateActivityInfoFilterIndex() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  // Leads with the equality filters of the content site list and then its
+  // order (see BuildClauses() and FindPage()), so matching rows are found
+  // and read in order without a sort. The other activity columns the list
+  // reads come last, so activity_info itself is not read; only the joined
+  // publisher_info row is looked up per row.
+  return GetDB().Execute(
+      "CREATE INDEX IF NOT EXISTS activity_info_filter_index "
+      "ON activity_info "
+      "(category, month, year, reconcile_stamp, percent, publisher_id, "
+      "duration, score, weight)");
+}
+
 bool PublisherInfoDatabase::CreateMediaPublisherInfoTable() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
@@ -238,62 +292,116 @@ bool PublisherInfoDatabase::InsertOrUpdatePublisherInfo(
   if (!initialized)
     return false;
 
-  sql::Statement publisher_info_statement(
-      GetDB().GetCachedStatement(SQL_FROM_HERE,
-          "INSERT OR REPLACE INTO publisher_info "
-          "(publisher_id, verified, excluded, "
-          "name, url, provider, favIcon) "
-          "VALUES (?, ?, ?, ?, ?, ?, ?)"));
-
-  publisher_info_statement.BindString(0, info.id);
-  publisher_info_statement.BindBool(1, info.verified);
-  publisher_info_statement.BindInt(2, static_cast<int>(info.excluded));
-  publisher_info_statement.BindString(3, info.name);
-  publisher_info_statement.BindString(4, info.url);
-  publisher_info_statement.BindString(5, info.provider);
-  publisher_info_statement.BindString(6, info.favicon_url);
-
-  if (!publisher_info_statement.Run()) {
+  sql::Transaction transaction(&GetDB());
+  if (!transaction.Begin())
     return false;
-  }
 
-  if (info.month == ledger::PUBLISHER_MONTH::ANY || info.year == -1) {
+  if (!InsertOrUpdatePublisherInfoInternal(info))
+    return false;
+
+  return transaction.Commit();
+}
+
+bool PublisherInfoDatabase::InsertOrUpdatePublisherInfoList(
+    const ledger::PublisherInfoList& list) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (list.empty())
     return true;
+
+  bool initialized = Init();
+  DCHECK(initialized);
+
+  if (!initialized)
+    return false;
+
+  // One transaction (and so one journal sync) for the whole batch. A failed
+  // row rolls back the batch, which RewardsServiceImpl puts back in its
+  // pending entries and writes again with the next flush.
+  sql::Transaction transaction(&GetDB());
+  if (!transaction.Begin())
+    return false;
+
+  for (const auto& info : list) {
+    if (!InsertOrUpdatePublisherInfoInternal(info))
+      return false;
   }
 
-  sql::Statement activity_get(
-      db_.GetUniqueStatement("SELECT publisher_id FROM activity_info WHERE "
-                             "publisher_id=? AND category=? "
-                             "AND month=? AND year=? AND reconcile_stamp=?"));
+  return transaction.Commit();
+}
 
-  activity_get.BindString(0, info.id);
-  activity_get.BindInt(1, info.category);
-  activity_get.BindInt(2, info.month);
-  activity_get.BindInt(3, info.year);
-  activity_get.BindInt64(4, info.reconcile_stamp);
+bool PublisherInfoDatabase::InsertOrUpdatePublisherInfoInternal(
+    const ledger::PublisherInfo& info) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  if (activity_get.Step()) {
-    sql::Statement activity_info_update(
+  // Update first and only insert when no row was touched, rather than
+  // INSERT OR REPLACE, which deletes the existing row first.
+  sql::Statement publisher_info_update(
       GetDB().GetCachedStatement(SQL_FROM_HERE,
-          "UPDATE activity_info SET "
-          "duration=?, score=?, percent=?, "
-          "weight=? WHERE "
-          "publisher_id=? AND category=? "
-          "AND month=? AND year=? AND reconcile_stamp=?"));
-
-    activity_info_update.BindInt64(0, (int)info.duration);
-    activity_info_update.BindDouble(1, info.score);
-    activity_info_update.BindInt64(2, (int)info.percent);
-    activity_info_update.BindDouble(3, info.weight);
-    activity_info_update.BindString(4, info.id);
-    activity_info_update.BindInt(5, info.category);
-    activity_info_update.BindInt(6, info.month);
-    activity_info_update.BindInt(7, info.year);
-    activity_info_update.BindInt64(8, info.reconcile_stamp);
-
-    return activity_info_update.Run();
+          "UPDATE publisher_info SET "
+          "verified=?, excluded=?, name=?, url=?, provider=?, favIcon=? "
+          "WHERE publisher_id=?"));
+
+  publisher_info_update.BindBool(0, info.verified);
+  publisher_info_update.BindInt(1, static_cast<int>(info.excluded));
+  publisher_info_update.BindString(2, info.name);
+  publisher_info_update.BindString(3, info.url);
+  publisher_info_update.BindString(4, info.provider);
+  publisher_info_update.BindString(5, info.favicon_url);
+  publisher_info_update.BindString(6, info.id);
+
+  if (!publisher_info_update.Run())
+    return false;
+
+  if (GetDB().GetLastChangeCount() == 0) {
+    sql::Statement publisher_info_insert(
+        GetDB().GetCachedStatement(SQL_FROM_HERE,
+            "INSERT INTO publisher_info "
+            "(publisher_id, verified, excluded, "
+            "name, url, provider, favIcon) "
+            "VALUES (?, ?, ?, ?, ?, ?, ?)"));
+
+    publisher_info_insert.BindString(0, info.id);
+    publisher_info_insert.BindBool(1, info.verified);
+    publisher_info_insert.BindInt(2, static_cast<int>(info.excluded));
+    publisher_info_insert.BindString(3, info.name);
+    publisher_info_insert.BindString(4, info.url);
+    publisher_info_insert.BindString(5, info.provider);
+    publisher_info_insert.BindString(6, info.favicon_url);
+
+    if (!publisher_info_insert.Run())
+      return false;
+  }
+
+  if (info.month == ledger::PUBLISHER_MONTH::ANY || info.year == -1) {
+    return true;
   }
 
+  // Same for activity_info, which has no unique key to replace on.
+  sql::Statement activity_info_update(
+    GetDB().GetCachedStatement(SQL_FROM_HERE,
+        "UPDATE activity_info SET "
+        "duration=?, score=?, percent=?, "
+        "weight=? WHERE "
+        "publisher_id=? AND category=? "
+        "AND month=? AND year=? AND reconcile_stamp=?"));
+
+  activity_info_update.BindInt64(0, (int)info.duration);
+  activity_info_update.BindDouble(1, info.score);
+  activity_info_update.BindInt64(2, (int)info.percent);
+  activity_info_update.BindDouble(3, info.weight);
+  activity_info_update.BindString(4, info.id);
+  activity_info_update.BindInt(5, info.category);
+  activity_info_update.BindInt(6, info.month);
+  activity_info_update.BindInt(7, info.year);
+  activity_info_update.BindInt64(8, info.reconcile_stamp);
+
+  if (!activity_info_update.Run())
+    return false;
+
+  if (GetDB().GetLastChangeCount() > 0)
+    return true;
+
   sql::Statement activity_info_insert(
     GetDB().GetCachedStatement(SQL_FROM_HERE,
         "INSERT INTO activity_info "
@@ -348,11 +456,12 @@ PublisherInfoDatabase::GetMediaPublisherInfo(const std::string& media_key) {
     return info;
 
   sql::Statement info_sql(
-      db_.GetUniqueStatement("SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
-                             "pi.provider, pi.verified, pi.excluded "
-                             "FROM media_publisher_info as mpi "
-                             "INNER JOIN publisher_info AS pi ON mpi.publisher_id = pi.publisher_id "
-                             "WHERE mpi.media_key=?"));
+      GetDB().GetCachedStatement(SQL_FROM_HERE,
+          "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
+          "pi.provider, pi.verified, pi.excluded "
+          "FROM media_publisher_info as mpi "
+          "INNER JOIN publisher_info AS pi ON mpi.publisher_id = pi.publisher_id "
+          "WHERE mpi.media_key=?"));
 
   info_sql.BindString(0, media_key);
 
@@ -369,10 +478,91 @@ PublisherInfoDatabase::GetMediaPublisherInfo(const std::string& media_key) {
   return info;
 }
 
+std::unique_ptr<ledger::PublisherInfo>
+PublisherInfoDatabase::GetPublisherInfo(const std::string& publisher_key) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  bool initialized = Init();
+  DCHECK(initialized);
+
+  std::unique_ptr<ledger::PublisherInfo> info;
+
+  if (!initialized)
+    return info;
+
+  sql::Statement info_sql(
+      GetDB().GetCachedStatement(SQL_FROM_HERE,
+          "SELECT publisher_id, name, url, favIcon, provider, verified "
+          "FROM publisher_info WHERE publisher_id=?"));
+
+  info_sql.BindString(0, publisher_key);
+
+  if (info_sql.Step()) {
+    info.reset(new ledger::PublisherInfo(info_sql.ColumnString(0),
+                                         ledger::PUBLISHER_MONTH::ANY, -1));
+    info->name = info_sql.ColumnString(1);
+    info->url = info_sql.ColumnString(2);
+    info->favicon_url = info_sql.ColumnString(3);
+    info->provider = info_sql.ColumnString(4);
+    info->verified = info_sql.ColumnBool(5);
+  }
+  return info;
+}
+
 bool PublisherInfoDatabase::Find(int start,
                                  int limit,
                                  const ledger::PublisherInfoFilter& filter,
                                  ledger::PublisherInfoList* list) {
+  return FindInternal(start, limit, filter, nullptr, list, nullptr);
+}
+
+bool PublisherInfoDatabase::FindWithCount(
+    int start,
+    int limit,
+    const ledger::PublisherInfoFilter& filter,
+    ledger::PublisherInfoList* list,
+    int* count) {
+  CHECK(count);
+  return FindInternal(start, limit, filter, nullptr, list, count);
+}
+
+bool PublisherInfoDatabase::FindPage(int limit,
+                                     const ledger::PublisherInfoFilter& filter,
+                                     const PublisherInfoCursor& after,
+                                     ledger::PublisherInfoList* list,
+                                     PublisherInfoCursor* next,
+                                     int* count) {
+  CHECK(next);
+  CHECK(count);
+
+  // Both descending, so activity_info_filter_index is walked backwards
+  // instead of sorting.
+  ledger::PublisherInfoFilter page_filter = filter;
+  page_filter.order_by.clear();
+  page_filter.order_by.push_back(std::make_pair("ai.percent", false));
+  page_filter.order_by.push_back(std::make_pair("ai.publisher_id", false));
+
+  const size_t first = list->size();
+  if (!FindInternal(0, limit, page_filter, &after, list, count))
+    return false;
+
+  next->valid = list->size() > first;
+  if (next->valid) {
+    next->percent = list->back().percent;
+    next->publisher_id = list->back().id;
+  } else {
+    *next = after;
+  }
+  return true;
+}
+
+bool PublisherInfoDatabase::FindInternal(
+    int start,
+    int limit,
+    const ledger::PublisherInfoFilter& filter,
+    const PublisherInfoCursor* after,
+    ledger::PublisherInfoList* list,
+    int* count) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
   CHECK(list);
@@ -383,46 +573,49 @@ bool PublisherInfoDatabase::Find(int start,
   if (!initialized)
     return false;
 
-  std::string query = "SELECT ai.publisher_id, ai.duration, ai.score, ai.percent, "
-      "ai.weight, pi.verified, pi.excluded, ai.category, ai.month, ai.year, pi.name, "
-      "pi.url, pi.provider, pi.favIcon, ai.reconcile_stamp "
-      "FROM activity_info AS ai "
-      "INNER JOIN publisher_info AS pi ON ai.publisher_id = pi.publisher_id "
-      "WHERE 1 = 1";
+  // Rows and total are read in one transaction, so they agree with each
+  // other.
+  sql::Transaction transaction(&GetDB());
+  if (count && !transaction.Begin())
+    return false;
+
+  const bool seek = after && after->valid;
+
+  std::string query = kActivityInfoColumns;
+  query += kActivityInfoTables;
 
-  query+= BuildClauses(start, limit, filter);
+  query+= BuildClauses(start, limit, filter, seek);
 
-  sql::Statement info_sql(db_.GetUniqueStatement(query.c_str()));
+  sql::Statement info_sql(GetDB().GetCachedStatement(
+      GetFilterStatementId(query), query.c_str()));
 
-  BindFilter(info_sql, filter);
+  int column = BindFilter(info_sql, filter);
+  if (seek) {
+    info_sql.BindInt64(column++, after->percent);
+    info_sql.BindInt64(column++, after->percent);
+    info_sql.BindString(column++, after->publisher_id);
+  }
+  if (limit > 0) {
+    info_sql.BindInt(column++, limit);
 
+    if (start > 1) {
+      info_sql.BindInt(column++, start);
+    }
+  }
+
+  int rows = 0;
   while (info_sql.Step()) {
-    std::string id(info_sql.ColumnString(0));
-    ledger::PUBLISHER_MONTH month(
-        static_cast<ledger::PUBLISHER_MONTH>(info_sql.ColumnInt(8)));
-    int year(info_sql.ColumnInt(9));
-
-    ledger::PublisherInfo info(id, month, year);
-    info.duration = info_sql.ColumnInt64(1);
-
-    info.score = info_sql.ColumnDouble(2);
-    info.percent = info_sql.ColumnInt64(3);
-    info.weight = info_sql.ColumnDouble(4);
-    info.verified = info_sql.ColumnBool(5);
-    info.name = info_sql.ColumnString(10);
-    info.url = info_sql.ColumnString(11);
-    info.provider = info_sql.ColumnString(12);
-    info.favicon_url = info_sql.ColumnString(13);
-    info.reconcile_stamp = info_sql.ColumnInt64(14);
-
-    info.excluded = static_cast<ledger::PUBLISHER_EXCLUDE>(info_sql.ColumnInt(6));
-    info.category =
-        static_cast<ledger::PUBLISHER_CATEGORY>(info_sql.ColumnInt(7));
-
-    list->push_back(info);
+    list->push_back(GetActivityInfo(info_sql));
+    ++rows;
   }
 
-  return list;
+  if (count) {
+    // Without paging the rows already are the total, no need to count again.
+    *count = limit > 0 ? Count(filter) : rows;
+    return transaction.Commit();
+  }
+
+  return true;
 }
 
 int PublisherInfoDatabase::Count(const ledger::PublisherInfoFilter& filter) {
@@ -439,9 +632,10 @@ int PublisherInfoDatabase::Count(const ledger::PublisherInfoFilter& filter) {
       "INNER JOIN publisher_info AS pi ON ai.publisher_id = pi.publisher_id "
       "WHERE 1 = 1";
 
-  query+= BuildClauses(0, 0, filter);
+  query+= BuildClauses(0, 0, filter, false);
 
-  sql::Statement publisher_count(db_.GetUniqueStatement(query.c_str()));
+  sql::Statement publisher_count(GetDB().GetCachedStatement(
+      GetFilterStatementId(query), query.c_str()));
 
   BindFilter(publisher_count, filter);
 
@@ -453,7 +647,8 @@ int PublisherInfoDatabase::Count(const ledger::PublisherInfoFilter& filter) {
 
 std::string PublisherInfoDatabase::BuildClauses(int start,
                                                 int limit,
-                                                const ledger::PublisherInfoFilter& filter) {
+                                                const ledger::PublisherInfoFilter& filter,
+                                                bool seek) {
   std::string clauses = "";
 
   if (!filter.id.empty())
@@ -483,24 +678,41 @@ std::string PublisherInfoDatabase::BuildClauses(int start,
     ledger::PUBLISHER_EXCLUDE_FILTER::FILTER_ALL_EXCEPT_EXCLUDED)
     clauses += " AND pi.excluded != ?";
 
-  for (const auto& it : filter.order_by) {
-    clauses += " ORDER BY " + it.first;
-    clauses += (it.second ? " ASC" : " DESC");
+  // Rows after a FindPage() cursor, in its (percent, publisher_id) order.
+  if (seek) {
+    clauses += " AND (ai.percent < ? OR "
+        "(ai.percent = ? AND ai.publisher_id < ?))";
+  }
+
+  for (size_t i = 0; i < filter.order_by.size(); ++i) {
+    clauses += i == 0 ? " ORDER BY " : ", ";
+    clauses += filter.order_by[i].first;
+    clauses += (filter.order_by[i].second ? " ASC" : " DESC");
   }
 
+  // Bound rather than inlined, so paging doesn't change the statement.
   if (limit > 0) {
-    clauses += " LIMIT " + std::to_string(limit);
+    clauses += " LIMIT ?";
 
     if (start > 1) {
-      clauses += " OFFSET " + std::to_string(start);
+      clauses += " OFFSET ?";
     }
   }
 
   return clauses;
 }
 
-void PublisherInfoDatabase::BindFilter(sql::Statement& statement,
-                                       const ledger::PublisherInfoFilter& filter) {
+sql::StatementID PublisherInfoDatabase::GetFilterStatementId(
+    const std::string& query) {
+  // The SQL only varies with which clauses the filter uses, so it doubles as
+  // the cache key. sql::StatementID keeps the pointer, hence the copy in
+  // |filter_statement_ids_|, which lives as long as |db_|.
+  const std::string& id = *filter_statement_ids_.insert(query).first;
+  return sql::StatementID(id.c_str());
+}
+
+int PublisherInfoDatabase::BindFilter(sql::Statement& statement,
+                                      const ledger::PublisherInfoFilter& filter) {
   int column = 0;
   if (!filter.id.empty())
     statement.BindString(column++, filter.id);
@@ -528,6 +740,8 @@ void PublisherInfoDatabase::BindFilter(sql::Statement& statement,
   if (filter.excluded ==
     ledger::PUBLISHER_EXCLUDE_FILTER::FILTER_ALL_EXCEPT_EXCLUDED)
     statement.BindInt(column++, ledger::PUBLISHER_EXCLUDE::EXCLUDED);
+
+  return column;
 }
 
 bool PublisherInfoDatabase::InsertContributionInfo(const brave_rewards::ContributionInfo& info) {
@@ -586,10 +800,11 @@ void PublisherInfoDatabase::GetRecurringDonations(ledger::PublisherInfoList* lis
     return;
 
   sql::Statement info_sql(
-      db_.GetUniqueStatement("SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
-                             "rd.amount, rd.added_date, pi.verified, pi.provider "
-                             "FROM recurring_donation as rd "
-                             "INNER JOIN publisher_info AS pi ON rd.publisher_id = pi.publisher_id "));
+      GetDB().GetCachedStatement(SQL_FROM_HERE,
+          "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
+          "rd.amount, rd.added_date, pi.verified, pi.provider "
+          "FROM recurring_donation as rd "
+          "INNER JOIN publisher_info AS pi ON rd.publisher_id = pi.publisher_id "));
 
   while (info_sql.Step()) {
     std::string id(info_sql.ColumnString(0));
@@ -618,12 +833,13 @@ void PublisherInfoDatabase::GetTips(ledger::PublisherInfoList* list, ledger::PUB
     return;
 
   sql::Statement info_sql(
-      db_.GetUniqueStatement("SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
-                             "ci.probi, ci.date, pi.verified, pi.provider "
-                             "FROM contribution_info as ci "
-                             "INNER JOIN publisher_info AS pi ON ci.publisher_id = pi.publisher_id "
-                             "AND ci.month = ? AND ci.year = ? "
-                             "AND (ci.category = ? OR ci.category = ?)"));
+      GetDB().GetCachedStatement(SQL_FROM_HERE,
+          "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
+          "ci.probi, ci.date, pi.verified, pi.provider "
+          "FROM contribution_info as ci "
+          "INNER JOIN publisher_info AS pi ON ci.publisher_id = pi.publisher_id "
+          "AND ci.month = ? AND ci.year = ? "
+          "AND (ci.category = ? OR ci.category = ?)"));
 
   info_sql.BindInt(0, month);
   info_sql.BindInt(1, year);
@@ -751,6 +967,16 @@ bool PublisherInfoDatabase::MigrateV1toV2() {
   return CreateRecurringDonationIndex();
 }
 
+bool PublisherInfoDatabase::MigrateV2toV3() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!CreateActivityInfoFilterIndex())
+    return false;
+
+  // Let the planner pick up the new indexes right away.
+  return GetDB().Execute("ANALYZE activity_info");
+}
+
 sql::InitStatus PublisherInfoDatabase::EnsureCurrentVersion() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
@@ -764,14 +990,22 @@ sql::InitStatus PublisherInfoDatabase::EnsureCurrentVersion() {
   const int cur_version = GetCurrentVersion();
 
   // Migration from version 1 to version 2
-  if (old_version == 1 && cur_version == 2) {
+  if (old_version < 2 && cur_version >= 2) {
     if (!MigrateV1toV2()) {
       LOG(ERROR) << "DB: Error with MigrateV1toV2";
     }
+  }
 
-    meta_table_.SetVersionNumber(cur_version);
+  // Migration from version 2 to version 3
+  if (old_version < 3 && cur_version >= 3) {
+    if (!MigrateV2toV3()) {
+      LOG(ERROR) << "DB: Error with MigrateV2toV3";
+    }
   }
 
+  if (old_version < cur_version)
+    meta_table_.SetVersionNumber(cur_version);
+
   return sql::INIT_OK;
 }
 
@@ -6,7 +6,10 @@
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_PUBLISHER_INFO_DATABASE_H_
 
 #include <memory>
+#include <set>
 #include <stddef.h>
+#include <stdint.h>
+#include <string>
 
 #include "base/compiler_specific.h"
 #include "base/files/file_path.h"
@@ -23,6 +26,14 @@
 
 namespace brave_rewards {
 
+// Position after the last row of a page returned by
+// PublisherInfoDatabase::FindPage().
+struct PublisherInfoCursor {
+  bool valid = false;
+  int64_t percent = 0;
+  std::string publisher_id;
+};
+
 class PublisherInfoDatabase {
  public:
   PublisherInfoDatabase(const base::FilePath& db_path);
@@ -35,6 +46,8 @@ class PublisherInfoDatabase {
   }
 
   bool InsertOrUpdatePublisherInfo(const ledger::PublisherInfo& info);
+  // Writes all of |list| in a single transaction, or none of it on failure.
+  bool InsertOrUpdatePublisherInfoList(const ledger::PublisherInfoList& list);
   bool InsertOrUpdateMediaPublisherInfo(const std::string& media_key, const std::string& publisher_id);
   bool InsertContributionInfo(const brave_rewards::ContributionInfo& info);
   bool InsertOrUpdateRecurringDonation(const brave_rewards::RecurringDonation& info);
@@ -43,10 +56,32 @@ class PublisherInfoDatabase {
             int limit,
             const ledger::PublisherInfoFilter& filter,
             ledger::PublisherInfoList* list);
+  // Same as Find(), and sets |count| to the number of rows matching |filter|
+  // regardless of |start| and |limit|, read in the same transaction.
+  bool FindWithCount(int start,
+                     int limit,
+                     const ledger::PublisherInfoFilter& filter,
+                     ledger::PublisherInfoList* list,
+                     int* count);
+  // Returns up to |limit| rows for |filter| ordered by percent and publisher
+  // id (both descending) that come after |after|, and sets |next| to the
+  // last of them. Unlike an offset, seeking past |after| doesn't walk the
+  // rows of the previous pages again. |count| is set as by FindWithCount().
+  // filter.order_by is ignored.
+  bool FindPage(int limit,
+                const ledger::PublisherInfoFilter& filter,
+                const PublisherInfoCursor& after,
+                ledger::PublisherInfoList* list,
+                PublisherInfoCursor* next,
+                int* count);
   int Count(const ledger::PublisherInfoFilter& filter);
 
   std::unique_ptr<ledger::PublisherInfo> GetMediaPublisherInfo(
       const std::string& media_key);
+  // Returns the publisher_info columns of |publisher_key| only, as the
+  // recurring donation and tip lists join them.
+  std::unique_ptr<ledger::PublisherInfo> GetPublisherInfo(
+      const std::string& publisher_key);
   void GetRecurringDonations(ledger::PublisherInfoList* list);
   void GetTips(ledger::PublisherInfoList* list, ledger::PUBLISHER_MONTH month, int year);
   bool RemoveRecurring(const std::string& publisher_key);
@@ -70,21 +105,37 @@ class PublisherInfoDatabase {
   bool CreateActivityInfoTable();
   bool CreateContributionInfoIndex();
   bool CreateActivityInfoIndex();
+  bool CreateActivityInfoFilterIndex();
   bool CreateRecurringDonationTable();
   bool CreateRecurringDonationIndex();
 
+  bool InsertOrUpdatePublisherInfoInternal(const ledger::PublisherInfo& info);
+  // Seeks past |after| instead of skipping |start| rows when it is given.
+  bool FindInternal(int start,
+                    int limit,
+                    const ledger::PublisherInfoFilter& filter,
+                    const PublisherInfoCursor* after,
+                    ledger::PublisherInfoList* list,
+                    int* count);
+
   std::string BuildClauses(int start,
                            int limit,
-                           const ledger::PublisherInfoFilter& filter);
-  void BindFilter(sql::Statement& statement,
-                  const ledger::PublisherInfoFilter& filter);
+                           const ledger::PublisherInfoFilter& filter,
+                           bool seek);
+  sql::StatementID GetFilterStatementId(const std::string& query);
+  // Returns the index of the next unbound parameter.
+  int BindFilter(sql::Statement& statement,
+                 const ledger::PublisherInfoFilter& filter);
 
   sql::Database& GetDB();
   sql::MetaTable& GetMetaTable();
 
   sql::InitStatus EnsureCurrentVersion();
   bool MigrateV1toV2();
+  bool MigrateV2toV3();
 
+  // Declared before |db_| so the ids outlive its statement cache.
+  std::set<std::string> filter_statement_ids_;
   sql::Database db_;
   sql::MetaTable meta_table_;
   const base::FilePath db_path_;
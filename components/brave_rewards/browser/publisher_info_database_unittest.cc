@@ -0,0 +1,266 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/publisher_info_database.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/scoped_task_environment.h"
+#include "sql/database.h"
+#include "sql/meta_table.h"
+#include "sql/statement.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+using brave_rewards::PublisherInfoCursor;
+using brave_rewards::PublisherInfoDatabase;
+
+const int kYear = 2019;
+const uint64_t kReconcileStamp = 1000;
+
+ledger::PublisherInfo MakePublisherInfo(const std::string& id,
+                                        const std::string& name,
+                                        uint64_t duration,
+                                        uint32_t percent) {
+  ledger::PublisherInfo info(id, ledger::PUBLISHER_MONTH::JANUARY, kYear);
+  info.name = name;
+  info.url = "https://" + id;
+  info.provider = "";
+  info.favicon_url = "";
+  info.category = ledger::PUBLISHER_CATEGORY::AUTO_CONTRIBUTE;
+  info.reconcile_stamp = kReconcileStamp;
+  info.duration = duration;
+  info.percent = percent;
+  return info;
+}
+
+class PublisherInfoDatabaseTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    database_.reset(new PublisherInfoDatabase(GetDatabasePath()));
+  }
+
+  base::FilePath GetDatabasePath() {
+    return temp_dir_.GetPath().AppendASCII("publisher_info_db");
+  }
+
+  ledger::PublisherInfoFilter MakeFilter() {
+    ledger::PublisherInfoFilter filter;
+    filter.category = ledger::PUBLISHER_CATEGORY::AUTO_CONTRIBUTE;
+    filter.month = ledger::PUBLISHER_MONTH::JANUARY;
+    filter.year = kYear;
+    filter.reconcile_stamp = kReconcileStamp;
+    filter.excluded = ledger::PUBLISHER_EXCLUDE_FILTER::FILTER_ALL;
+    filter.order_by.push_back(std::make_pair("ai.publisher_id", true));
+    return filter;
+  }
+
+  // Needed by the database's memory pressure listener.
+  base::test::ScopedTaskEnvironment scoped_task_environment_;
+  base::ScopedTempDir temp_dir_;
+  std::unique_ptr<PublisherInfoDatabase> database_;
+};
+
+TEST_F(PublisherInfoDatabaseTest, InsertOrUpdatePublisherInfoList) {
+  ledger::PublisherInfoList list;
+  list.push_back(MakePublisherInfo("a.com", "A", 10, 60));
+  list.push_back(MakePublisherInfo("b.com", "B", 20, 40));
+  EXPECT_TRUE(database_->InsertOrUpdatePublisherInfoList(list));
+
+  ledger::PublisherInfoList found;
+  EXPECT_TRUE(database_->Find(0, 0, MakeFilter(), &found));
+  ASSERT_EQ(2u, found.size());
+  EXPECT_EQ("a.com", found[0].id);
+  EXPECT_EQ("b.com", found[1].id);
+
+  // Updates a.com in both tables and inserts c.com.
+  list.clear();
+  list.push_back(MakePublisherInfo("a.com", "A2", 30, 70));
+  list.push_back(MakePublisherInfo("c.com", "C", 5, 30));
+  EXPECT_TRUE(database_->InsertOrUpdatePublisherInfoList(list));
+
+  found.clear();
+  EXPECT_TRUE(database_->Find(0, 0, MakeFilter(), &found));
+  ASSERT_EQ(3u, found.size());
+  EXPECT_EQ("a.com", found[0].id);
+  EXPECT_EQ("A2", found[0].name);
+  EXPECT_EQ(30u, found[0].duration);
+  EXPECT_EQ(70u, found[0].percent);
+  EXPECT_EQ("b.com", found[1].id);
+  EXPECT_EQ("B", found[1].name);
+  EXPECT_EQ("c.com", found[2].id);
+
+  std::unique_ptr<ledger::PublisherInfo> info =
+      database_->GetPublisherInfo("a.com");
+  ASSERT_TRUE(info);
+  EXPECT_EQ("A2", info->name);
+}
+
+TEST_F(PublisherInfoDatabaseTest, InsertOrUpdatePublisherInfoWithoutActivity) {
+  ledger::PublisherInfo info("a.com", ledger::PUBLISHER_MONTH::ANY, -1);
+  info.name = "A";
+  EXPECT_TRUE(database_->InsertOrUpdatePublisherInfo(info));
+  info.name = "A2";
+  info.verified = true;
+  EXPECT_TRUE(database_->InsertOrUpdatePublisherInfo(info));
+
+  std::unique_ptr<ledger::PublisherInfo> found =
+      database_->GetPublisherInfo("a.com");
+  ASSERT_TRUE(found);
+  EXPECT_EQ("A2", found->name);
+  EXPECT_TRUE(found->verified);
+
+  // No activity row was written.
+  ledger::PublisherInfoList list;
+  EXPECT_TRUE(database_->Find(0, 0, MakeFilter(), &list));
+  EXPECT_TRUE(list.empty());
+}
+
+TEST_F(PublisherInfoDatabaseTest, FindWithCount) {
+  ledger::PublisherInfoList list;
+  list.push_back(MakePublisherInfo("a.com", "A", 10, 50));
+  list.push_back(MakePublisherInfo("b.com", "B", 20, 30));
+  list.push_back(MakePublisherInfo("c.com", "C", 30, 20));
+  EXPECT_TRUE(database_->InsertOrUpdatePublisherInfoList(list));
+
+  ledger::PublisherInfoList found;
+  int count = 0;
+  EXPECT_TRUE(database_->FindWithCount(0, 2, MakeFilter(), &found, &count));
+  EXPECT_EQ(2u, found.size());
+  EXPECT_EQ(3, count);
+
+  found.clear();
+  count = 0;
+  EXPECT_TRUE(database_->FindWithCount(0, 0, MakeFilter(), &found, &count));
+  EXPECT_EQ(3u, found.size());
+  EXPECT_EQ(3, count);
+
+  // Paged past the last row.
+  found.clear();
+  count = 0;
+  EXPECT_TRUE(database_->FindWithCount(10, 2, MakeFilter(), &found, &count));
+  EXPECT_TRUE(found.empty());
+  EXPECT_EQ(3, count);
+
+  // The filter applies to the count too.
+  ledger::PublisherInfoFilter filter = MakeFilter();
+  filter.min_duration = 20;
+  found.clear();
+  EXPECT_TRUE(database_->FindWithCount(0, 1, filter, &found, &count));
+  EXPECT_EQ(1u, found.size());
+  EXPECT_EQ(2, count);
+}
+
+TEST_F(PublisherInfoDatabaseTest, FindPage) {
+  ledger::PublisherInfoList list;
+  list.push_back(MakePublisherInfo("a.com", "A", 10, 50));
+  list.push_back(MakePublisherInfo("b.com", "B", 20, 30));
+  list.push_back(MakePublisherInfo("c.com", "C", 30, 30));
+  list.push_back(MakePublisherInfo("d.com", "D", 40, 20));
+  EXPECT_TRUE(database_->InsertOrUpdatePublisherInfoList(list));
+
+  // Ties on percent are broken by publisher id, both descending.
+  ledger::PublisherInfoList found;
+  PublisherInfoCursor next;
+  int count = 0;
+  EXPECT_TRUE(database_->FindPage(2, MakeFilter(), PublisherInfoCursor(),
+                                  &found, &next, &count));
+  ASSERT_EQ(2u, found.size());
+  EXPECT_EQ("a.com", found[0].id);
+  EXPECT_EQ("c.com", found[1].id);
+  EXPECT_EQ(4, count);
+  ASSERT_TRUE(next.valid);
+  EXPECT_EQ(30, next.percent);
+  EXPECT_EQ("c.com", next.publisher_id);
+
+  // A row added before the cursor doesn't shift the next page.
+  list.clear();
+  list.push_back(MakePublisherInfo("e.com", "E", 50, 90));
+  EXPECT_TRUE(database_->InsertOrUpdatePublisherInfoList(list));
+
+  const PublisherInfoCursor after = next;
+  found.clear();
+  EXPECT_TRUE(database_->FindPage(2, MakeFilter(), after, &found, &next,
+                                  &count));
+  ASSERT_EQ(2u, found.size());
+  EXPECT_EQ("b.com", found[0].id);
+  EXPECT_EQ("d.com", found[1].id);
+  EXPECT_EQ(5, count);
+
+  found.clear();
+  EXPECT_TRUE(database_->FindPage(2, MakeFilter(), next, &found, &next,
+                                  &count));
+  EXPECT_TRUE(found.empty());
+}
+
+TEST_F(PublisherInfoDatabaseTest, MigrateV2toV3) {
+  database_.reset();
+  {
+    // The schema as version 2 left it.
+    sql::Database db;
+    ASSERT_TRUE(db.Open(GetDatabasePath()));
+    sql::MetaTable meta_table;
+    ASSERT_TRUE(meta_table.Init(&db, 2, 1));
+    ASSERT_TRUE(db.Execute(
+        "CREATE TABLE publisher_info ("
+        "publisher_id LONGVARCHAR PRIMARY KEY NOT NULL UNIQUE,"
+        "verified BOOLEAN DEFAULT 0 NOT NULL,"
+        "excluded INTEGER DEFAULT 0 NOT NULL,"
+        "name TEXT NOT NULL,"
+        "favIcon TEXT NOT NULL,"
+        "url TEXT NOT NULL,"
+        "provider TEXT NOT NULL)"));
+    ASSERT_TRUE(db.Execute(
+        "CREATE TABLE activity_info ("
+        "publisher_id LONGVARCHAR NOT NULL,"
+        "duration INTEGER DEFAULT 0 NOT NULL,"
+        "score DOUBLE DEFAULT 0 NOT NULL,"
+        "percent INTEGER DEFAULT 0 NOT NULL,"
+        "weight DOUBLE DEFAULT 0 NOT NULL,"
+        "category INTEGER NOT NULL,"
+        "month INTEGER NOT NULL,"
+        "year INTEGER NOT NULL,"
+        "reconcile_stamp INTEGER DEFAULT 0 NOT NULL)"));
+    ASSERT_TRUE(db.Execute(
+        "CREATE INDEX activity_info_publisher_id_index "
+        "ON activity_info (publisher_id)"));
+    ASSERT_TRUE(db.Execute(
+        "INSERT INTO publisher_info VALUES "
+        "('a.com', 0, 0, 'A', '', 'https://a.com', '')"));
+    sql::Statement activity_info_insert(db.GetUniqueStatement(
+        "INSERT INTO activity_info VALUES "
+        "('a.com', 10, 0, 100, 0, ?, ?, ?, ?)"));
+    activity_info_insert.BindInt(0,
+                                 ledger::PUBLISHER_CATEGORY::AUTO_CONTRIBUTE);
+    activity_info_insert.BindInt(1, ledger::PUBLISHER_MONTH::JANUARY);
+    activity_info_insert.BindInt(2, kYear);
+    activity_info_insert.BindInt64(3, kReconcileStamp);
+    ASSERT_TRUE(activity_info_insert.Run());
+  }
+
+  database_.reset(new PublisherInfoDatabase(GetDatabasePath()));
+  ledger::PublisherInfoList found;
+  EXPECT_TRUE(database_->Find(0, 0, MakeFilter(), &found));
+  ASSERT_EQ(1u, found.size());
+  EXPECT_EQ("a.com", found[0].id);
+  EXPECT_EQ("A", found[0].name);
+  EXPECT_EQ(10u, found[0].duration);
+  database_.reset();
+
+  sql::Database db;
+  ASSERT_TRUE(db.Open(GetDatabasePath()));
+  sql::MetaTable meta_table;
+  ASSERT_TRUE(meta_table.Init(&db, 3, 1));
+  EXPECT_EQ(3, meta_table.GetVersionNumber());
+  EXPECT_EQ(3, PublisherInfoDatabase::GetCurrentVersion());
+  EXPECT_TRUE(db.DoesIndexExist("activity_info_filter_index"));
+  EXPECT_TRUE(db.DoesTableExist("recurring_donation"));
+}
+
+}  // namespace
@@ -11,16 +11,24 @@ namespace brave_rewards {
 RewardsFetcherServiceObserver::RewardsFetcherServiceObserver(
     const std::string& favicon_key,
     const GURL& url,
-    const OnImageChangedCallback& callback) :
+    const OnImageChangedCallback& callback,
+    const OnImageFailedCallback& failed_callback) :
   favicon_key_(favicon_key),
   url_(url),
-  callback_(callback) {
+  callback_(callback),
+  failed_callback_(failed_callback),
+  image_changed_(false) {
 }
 
-RewardsFetcherServiceObserver::~RewardsFetcherServiceObserver() {}
+RewardsFetcherServiceObserver::~RewardsFetcherServiceObserver() {
+  if (!image_changed_ && failed_callback_) {
+    failed_callback_.Run(favicon_key_);
+  }
+}
 
 void RewardsFetcherServiceObserver::OnImageChanged(BitmapFetcherService::RequestId request_id,
                                                    const SkBitmap& answers_image) {
+  image_changed_ = true;
   if (callback_) {
     callback_.Run(favicon_key_, url_, request_id, answers_image);
   }
@@ -17,12 +17,17 @@ namespace brave_rewards {
         const GURL& url,
         const BitmapFetcherService::RequestId& request_id,
         const SkBitmap &answers_image)>;
+  // BitmapFetcherService drops the observer without notifying it when the
+  // fetch fails, is cancelled or can't be started.
+  using OnImageFailedCallback = base::Callback<void(
+        const std::string& favicon_key)>;
 
 class RewardsFetcherServiceObserver : public BitmapFetcherService::Observer {
   public:
     RewardsFetcherServiceObserver(const std::string& favicon_key,
                                   const GURL& url,
-                                  const OnImageChangedCallback& callback);
+                                  const OnImageChangedCallback& callback,
+                                  const OnImageFailedCallback& failed_callback);
     ~RewardsFetcherServiceObserver() override;
     void OnImageChanged(BitmapFetcherService::RequestId request_id,
                         const SkBitmap& answers_image) override;
@@ -31,6 +36,8 @@ class RewardsFetcherServiceObserver : public BitmapFetcherService::Observer {
     std::string favicon_key_;
     GURL url_;
     OnImageChangedCallback callback_;
+    OnImageFailedCallback failed_callback_;
+    bool image_changed_;
 };
 
 }  // namespace brave_rewards
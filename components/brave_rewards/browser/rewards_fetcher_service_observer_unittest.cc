@@ -0,0 +1,71 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/rewards_fetcher_service_observer.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+
+namespace {
+
+using brave_rewards::RewardsFetcherServiceObserver;
+
+const char kFaviconKey[] = "https://www.youtube.com/channel/brave";
+
+class RewardsFetcherServiceObserverTest : public testing::Test {
+ protected:
+  std::unique_ptr<RewardsFetcherServiceObserver> CreateObserver() {
+    return std::make_unique<RewardsFetcherServiceObserver>(
+        kFaviconKey,
+        GURL("https://yt3.ggpht.com/favicon.png"),
+        base::Bind(&RewardsFetcherServiceObserverTest::OnImageChanged,
+                   base::Unretained(this)),
+        base::Bind(&RewardsFetcherServiceObserverTest::OnImageFailed,
+                   base::Unretained(this)));
+  }
+
+  void OnImageChanged(const std::string& favicon_key,
+                      const GURL& url,
+                      const BitmapFetcherService::RequestId& request_id,
+                      const SkBitmap& image) {
+    changed_.push_back(favicon_key);
+  }
+
+  void OnImageFailed(const std::string& favicon_key) {
+    failed_.push_back(favicon_key);
+  }
+
+  std::vector<std::string> changed_;
+  std::vector<std::string> failed_;
+};
+
+TEST_F(RewardsFetcherServiceObserverTest, ReportsImage) {
+  std::unique_ptr<RewardsFetcherServiceObserver> observer = CreateObserver();
+  SkBitmap image;
+  image.allocN32Pixels(16, 16);
+  observer->OnImageChanged(1, image);
+  observer.reset();
+
+  ASSERT_EQ(1u, changed_.size());
+  EXPECT_EQ(kFaviconKey, changed_[0]);
+  EXPECT_TRUE(failed_.empty());
+}
+
+TEST_F(RewardsFetcherServiceObserverTest, ReportsFailureWhenDropped) {
+  // What BitmapFetcherService does with the observer of a failed or
+  // cancelled fetch.
+  std::unique_ptr<RewardsFetcherServiceObserver> observer = CreateObserver();
+  observer.reset();
+
+  EXPECT_TRUE(changed_.empty());
+  ASSERT_EQ(1u, failed_.size());
+  EXPECT_EQ(kFaviconKey, failed_[0]);
+}
+
+}  // namespace
@@ -14,6 +14,7 @@
 #include "brave/components/brave_rewards/browser/rewards_notification_service_observer.h"
 #include "chrome/browser/profiles/profile.h"
 #include "components/prefs/pref_service.h"
+#include "components/prefs/scoped_user_pref_update.h"
 #include "extensions/buildflags/buildflags.h"
 
 #if BUILDFLAG(ENABLE_EXTENSIONS)
@@ -22,8 +23,26 @@
 
 namespace brave_rewards {
 
+namespace {
+
+std::unique_ptr<base::DictionaryValue> NotificationToValue(
+    const RewardsNotificationService::RewardsNotification& notification) {
+  auto dict = std::make_unique<base::DictionaryValue>();
+  dict->SetInteger("type", notification.type_);
+  dict->SetInteger("timestamp", notification.timestamp_);
+  auto args = std::make_unique<base::ListValue>();
+  for (auto& arg : notification.args_) {
+    args->AppendString(arg);
+  }
+  dict->SetList("args", std::move(args));
+  return dict;
+}
+
+}  // namespace
+
 RewardsNotificationServiceImpl::RewardsNotificationServiceImpl(Profile* profile)
-    : profile_(profile)
+    : profile_(profile),
+      notifications_loaded_(false)
 {
 #if BUILDFLAG(ENABLE_EXTENSIONS)
   extension_rewards_notification_service_observer_ = 
@@ -31,11 +50,9 @@ RewardsNotificationServiceImpl::RewardsNotificationServiceImpl(Profile* profile)
               profile);
   AddObserver(extension_rewards_notification_service_observer_.get());
 #endif
-  ReadRewardsNotifications();
 }
 
 RewardsNotificationServiceImpl::~RewardsNotificationServiceImpl() {
-  StoreRewardsNotifications();
 #if BUILDFLAG(ENABLE_EXTENSIONS)
   RemoveObserver(extension_rewards_notification_service_observer_.get());
 #endif
@@ -46,36 +63,51 @@ void RewardsNotificationServiceImpl::AddNotification(
     RewardsNotificationArgs args,
     RewardsNotificationID id) {
   DCHECK(type != REWARDS_NOTIFICATION_INVALID);
+  ReadRewardsNotifications();
   if (id.empty())
     id = GenerateRewardsNotificationID();
   RewardsNotification rewards_notification(
       id, type, GenerateRewardsNotificationTimestamp(), std::move(args));
   rewards_notifications_[id] = rewards_notification;
+  DictionaryPrefUpdate update(profile_->GetPrefs(),
+                              kRewardsNotificationEntries);
+  update->SetWithoutPathExpansion(id,
+                                  NotificationToValue(rewards_notification));
   OnNotificationAdded(rewards_notification);
 }
 
 void RewardsNotificationServiceImpl::DeleteNotification(RewardsNotificationID id) {
   DCHECK(!id.empty());
+  ReadRewardsNotifications();
   if (rewards_notifications_.find(id) == rewards_notifications_.end())
     return;
   RewardsNotification rewards_notification = rewards_notifications_[id];
   rewards_notifications_.erase(id);
+  DictionaryPrefUpdate update(profile_->GetPrefs(),
+                              kRewardsNotificationEntries);
+  update->RemoveWithoutPathExpansion(id, nullptr);
   OnNotificationDeleted(rewards_notification);
 }
 
 void RewardsNotificationServiceImpl::DeleteAllNotifications() {
+  // Nothing needs to be read when everything goes.
+  notifications_loaded_ = true;
   rewards_notifications_.clear();
+  profile_->GetPrefs()->ClearPref(kRewardsNotifications);
+  profile_->GetPrefs()->ClearPref(kRewardsNotificationEntries);
   OnAllNotificationsDeleted();
 }
 
 void RewardsNotificationServiceImpl::GetNotification(RewardsNotificationID id) {
   DCHECK(!id.empty());
+  ReadRewardsNotifications();
   if (rewards_notifications_.find(id) == rewards_notifications_.end())
     return;
   OnGetNotification(rewards_notifications_[id]);
 }
 
 void RewardsNotificationServiceImpl::GetAllNotifications() {
+  ReadRewardsNotifications();
   RewardsNotificationsList rewards_notifications_list;
   for (auto& item : rewards_notifications_) {
     rewards_notifications_list.push_back(item.second);
@@ -94,14 +126,52 @@ RewardsNotificationServiceImpl::GenerateRewardsNotificationTimestamp() const {
   return base::Time::NowFromSystemTime().ToTimeT();
 }
 
+// Notifications are loaded on first use rather than during profile init.
 void RewardsNotificationServiceImpl::ReadRewardsNotifications() {
+  if (notifications_loaded_)
+    return;
+  notifications_loaded_ = true;
+
+  const base::DictionaryValue* entries =
+      profile_->GetPrefs()->GetDictionary(kRewardsNotificationEntries);
+  for (const auto& entry : entries->DictItems()) {
+    if (!entry.second.is_dict())
+      continue;
+    const base::Value* type = entry.second.FindKeyOfType(
+        "type", base::Value::Type::INTEGER);
+    const base::Value* timestamp = entry.second.FindKeyOfType(
+        "timestamp", base::Value::Type::INTEGER);
+    const base::Value* args = entry.second.FindKeyOfType(
+        "args", base::Value::Type::LIST);
+    if (!type || !timestamp || !args)
+      continue;
+
+    RewardsNotificationArgs notification_args;
+    for (const auto& arg : args->GetList()) {
+      if (arg.is_string())
+        notification_args.push_back(arg.GetString());
+    }
+    RewardsNotification notification(entry.first,
+        static_cast<RewardsNotificationType>(type->GetInt()),
+        timestamp->GetInt(),
+        notification_args);
+    rewards_notifications_[notification.id_] = notification;
+  }
+
+  ReadLegacyRewardsNotifications();
+}
+
+// Older versions kept the notifications as a JSON string written on
+// shutdown. Move them to kRewardsNotificationEntries once.
+void RewardsNotificationServiceImpl::ReadLegacyRewardsNotifications() {
   std::string json = profile_->GetPrefs()->GetString(kRewardsNotifications);
   if (json.empty())
     return;
+  profile_->GetPrefs()->ClearPref(kRewardsNotifications);
   std::unique_ptr<base::ListValue> root =
       base::ListValue::From(base::JSONReader::Read(json));
   if (!root) {
-    LOG(ERROR) << "Failed to deserialize rewards notifications on startup";
+    LOG(ERROR) << "Failed to deserialize legacy rewards notifications";
     return;
   }
   for (auto it = root->begin(); it != root->end(); ++it) {
@@ -145,31 +215,19 @@ void RewardsNotificationServiceImpl::ReadRewardsNotifications() {
                                      notification_args);
     rewards_notifications_[notification.id_] = notification;
   }
+
+  StoreRewardsNotifications();
 }
 
+// Add and delete update kRewardsNotificationEntries as they happen, so this
+// is only needed to rewrite everything at once.
 void RewardsNotificationServiceImpl::StoreRewardsNotifications() {
-  base::ListValue root;
-
+  base::DictionaryValue entries;
   for (auto& item : rewards_notifications_) {
-    auto dict = std::make_unique<base::DictionaryValue>();
-    dict->SetString("id", item.second.id_);
-    dict->SetInteger("type", item.second.type_);
-    dict->SetInteger("timestamp", item.second.timestamp_);
-    auto args = std::make_unique<base::ListValue>();
-    for (auto& arg : item.second.args_) {
-      args->AppendString(arg);
-    }
-    dict->SetList("args", std::move(args));
-    root.Append(std::move(dict));
+    entries.SetWithoutPathExpansion(item.first,
+                                    NotificationToValue(item.second));
   }
-
-  std::string result;
-  if (!base::JSONWriter::Write(root, &result)) {
-    LOG(ERROR) << "Failed to serialize rewards notifications on shutdown";
-    return;
-  }
-
-  profile_->GetPrefs()->SetString(kRewardsNotifications, result);
+  profile_->GetPrefs()->Set(kRewardsNotificationEntries, entries);
 }
 
 void RewardsNotificationServiceImpl::TriggerOnNotificationAdded(
@@ -53,11 +53,14 @@ class RewardsNotificationServiceImpl
   void OnGetAllNotifications(
       const RewardsNotificationsList& rewards_notifications_list);
 
+  void ReadLegacyRewardsNotifications();
+
   RewardsNotificationID GenerateRewardsNotificationID() const;
   RewardsNotificationTimestamp GenerateRewardsNotificationTimestamp() const;
 
   Profile* profile_;
   std::map<RewardsNotificationID, RewardsNotification> rewards_notifications_;
+  bool notifications_loaded_;
 #if BUILDFLAG(ENABLE_EXTENSIONS)
   std::unique_ptr<ExtensionRewardsNotificationServiceObserver>
       extension_rewards_notification_service_observer_;
@@ -40,7 +40,9 @@ void RewardsService::RemoveObserver(RewardsServiceObserver* observer) {
 
 // static
 void RewardsService::RegisterProfilePrefs(PrefRegistrySimple* registry) {
+  // Superseded by kRewardsNotificationEntries, read once to migrate.
   registry->RegisterStringPref(kRewardsNotifications, "");
+  registry->RegisterDictionaryPref(kRewardsNotificationEntries);
 }
 
 }  // namespace brave_rewards
@@ -26,12 +26,16 @@
 #include "bat/ledger/wallet_info.h"
 #include "brave/common/brave_switches.h"
 #include "brave/components/brave_rewards/browser/balance_report.h"
+#include "brave/components/brave_rewards/browser/ledger_timer_queue.h"
+#include "brave/components/brave_rewards/browser/ledger_url_loader_pool.h"
+#include "brave/components/brave_rewards/browser/publisher_activity_accumulator.h"
 #include "brave/components/brave_rewards/browser/publisher_info_database.h"
 #include "brave/components/brave_rewards/browser/rewards_fetcher_service_observer.h"
 #include "brave/components/brave_rewards/browser/rewards_notification_service.h"
 #include "brave/components/brave_rewards/browser/rewards_notification_service_impl.h"
 #include "brave/components/brave_rewards/browser/rewards_service_factory.h"
 #include "brave/components/brave_rewards/browser/rewards_service_observer.h"
+#include "brave/components/brave_rewards/browser/state_file_writer.h"
 #include "brave/components/brave_rewards/browser/wallet_properties.h"
 #include "chrome/browser/bitmap_fetcher/bitmap_fetcher_service_factory.h"
 #include "chrome/browser/browser_process_impl.h"
@@ -45,12 +49,10 @@
 #include "net/base/escape.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "net/base/url_util.h"
-#include "net/url_request/url_fetcher.h"
 #include "publisher_banner.h"
 #include "ui/base/resource/resource_bundle.h"
 #include "ui/gfx/image/image.h"
 #include "url/gurl.h"
-#include "url/url_canon_stdstring.h"
 
 #if !defined(OS_ANDROID)
 #include "brave/components/brave_rewards/resources/grit/brave_rewards_resources.h"
@@ -72,13 +74,19 @@ namespace {
 
 class LedgerURLLoaderImpl : public ledger::LedgerURLLoader {
  public:
-  LedgerURLLoaderImpl(uint64_t request_id, net::URLFetcher* fetcher) :
+  LedgerURLLoaderImpl(uint64_t request_id,
+                      base::WeakPtr<LedgerURLLoaderPool> pool,
+                      const LedgerURLLoaderPool::Request& request,
+                      const LedgerURLLoaderPool::ResponseCallback& callback) :
     request_id_(request_id),
-    fetcher_(fetcher) {}
+    pool_(pool),
+    request_(request),
+    callback_(callback) {}
   ~LedgerURLLoaderImpl() override = default;
 
   void Start() override {
-    fetcher_->Start();
+    if (pool_)
+      pool_->Fetch(request_, callback_);
   }
 
   uint64_t request_id() override {
@@ -87,7 +95,9 @@ class LedgerURLLoaderImpl : public ledger::LedgerURLLoader {
 
  private:
   uint64_t request_id_;
-  net::URLFetcher* fetcher_;  // NOT OWNED
+  base::WeakPtr<LedgerURLLoaderPool> pool_;
+  LedgerURLLoaderPool::Request request_;
+  LedgerURLLoaderPool::ResponseCallback callback_;
 };
 
 ledger::PUBLISHER_MONTH GetPublisherMonth(const base::Time& time) {
@@ -117,17 +127,51 @@ ContentSite PublisherInfoToContentSite(
   return content_site;
 }
 
-net::URLFetcher::RequestType URLMethodToRequestType(ledger::URL_METHOD method) {
+PublisherInfoListSnapshot MakePublisherInfoListSnapshot(
+    ledger::PublisherInfoList list) {
+  return base::MakeRefCounted<base::RefCountedData<ledger::PublisherInfoList>>(
+      std::move(list));
+}
+
+// Copies the publisher details shown next to each entry of |snapshot| from
+// |publishers|, keeping the entry's own amount and date. Returns false and
+// leaves |snapshot| alone when none of its publishers are in |publishers|.
+bool UpdatePublisherInfoListSnapshot(
+    const std::map<std::string, const ledger::PublisherInfo*>& publishers,
+    PublisherInfoListSnapshot* snapshot) {
+  if (!*snapshot)
+    return false;
+
+  ledger::PublisherInfoList list((*snapshot)->data);
+  bool updated = false;
+  for (auto& entry : list) {
+    auto it = publishers.find(entry.id);
+    if (it == publishers.end())
+      continue;
+    entry.name = it->second->name;
+    entry.url = it->second->url;
+    entry.favicon_url = it->second->favicon_url;
+    entry.verified = it->second->verified;
+    entry.provider = it->second->provider;
+    updated = true;
+  }
+
+  if (updated)
+    *snapshot = MakePublisherInfoListSnapshot(std::move(list));
+  return updated;
+}
+
+std::string URLMethodToRequestType(ledger::URL_METHOD method) {
   switch(method) {
     case ledger::URL_METHOD::GET:
-      return net::URLFetcher::RequestType::GET;
+      return "GET";
     case ledger::URL_METHOD::POST:
-      return net::URLFetcher::RequestType::POST;
+      return "POST";
     case ledger::URL_METHOD::PUT:
-      return net::URLFetcher::RequestType::PUT;
+      return "PUT";
     default:
       NOTREACHED();
-      return net::URLFetcher::RequestType::GET;
+      return "GET";
   }
 }
 
@@ -166,13 +210,15 @@ LoadMediaPublisherInfoListOnFileTaskRunner(
   return info;
 }
 
-bool SavePublisherInfoOnFileTaskRunner(
-    const ledger::PublisherInfo publisher_info,
+// Returns the entries that were not written, i.e. all of them if the batch
+// failed.
+ledger::PublisherInfoList SavePublisherInfoListOnFileTaskRunner(
+    ledger::PublisherInfoList publisher_info_list,
     PublisherInfoDatabase* backend) {
-  if (backend && backend->InsertOrUpdatePublisherInfo(publisher_info))
-    return true;
+  if (backend && backend->InsertOrUpdatePublisherInfoList(publisher_info_list))
+    publisher_info_list.clear();
 
-  return false;
+  return publisher_info_list;
 }
 
 ledger::PublisherInfoList LoadPublisherInfoListOnFileTaskRunner(
@@ -188,32 +234,65 @@ ledger::PublisherInfoList LoadPublisherInfoListOnFileTaskRunner(
   return list;
 }
 
-// `callback` has a WeakPtr so this won't crash if the file finishes
-// writing after RewardsServiceImpl has been destroyed
-void PostWriteCallback(
-    const base::Callback<void(bool success)>& callback,
-    scoped_refptr<base::SequencedTaskRunner> reply_task_runner,
-    bool write_success) {
-  // We can't run |callback| on the current thread. Bounce back to
-  // the |reply_task_runner| which is the correct sequenced thread.
-  reply_task_runner->PostTask(FROM_HERE,
-                              base::Bind(callback, write_success));
+// The publishers list is large and usually unchanged between updates, so
+// skip the atomic write (and its fsync) when the file already holds |data|.
+bool SavePublishersListOnFileTaskRunner(const base::FilePath& path,
+                                        const std::string& data) {
+  std::string current;
+  if (base::ReadFileToString(path, &current) && current == data)
+    return true;
+
+  return base::ImportantFileWriter::WriteFileAtomically(path, data);
 }
 
-void GetContentSiteListInternal(
+ContentSiteListResult LoadContentSiteListOnFileTaskRunner(
     uint32_t start,
     uint32_t limit,
-    const GetContentSiteListCallback& callback,
-    const ledger::PublisherInfoList& publisher_list,
-    uint32_t next_record) {
-  std::unique_ptr<ContentSiteList> site_list(new ContentSiteList);
-  for (ledger::PublisherInfoList::const_iterator it =
-      publisher_list.begin(); it != publisher_list.end(); ++it) {
-    site_list->push_back(PublisherInfoToContentSite(*it));
+    ledger::PublisherInfoFilter filter,
+    PublisherInfoCursor after,
+    PublisherInfoDatabase* backend) {
+  ContentSiteListResult result;
+  if (!backend)
+    return result;
+
+  // Pages start from the top or from where the previous one ended; only a
+  // page asked for out of sequence has to skip rows.
+  if (limit > 0 && (start == 0 || after.valid)) {
+    ignore_result(backend->FindPage(limit, filter, after, &result.list,
+                                    &result.next, &result.count));
+  } else {
+    ignore_result(backend->FindWithCount(start, limit, filter,
+                                         &result.list, &result.count));
   }
-  callback.Run(std::move(site_list), next_record);
+  return result;
+}
+
+bool IsSameContentSiteListFilter(const ledger::PublisherInfoFilter& a,
+                                 const ledger::PublisherInfoFilter& b) {
+  return a.month == b.month && a.year == b.year &&
+      a.reconcile_stamp == b.reconcile_stamp &&
+      a.min_duration == b.min_duration;
 }
 
+// How long saved publisher info is kept in memory before it is written, and
+// how many entries may pile up before writing regardless.
+constexpr base::TimeDelta kPublisherInfoFlushDelay =
+    base::TimeDelta::FromSeconds(30);
+const size_t kMaxPendingPublisherInfo = 100;
+// How many times in a row a batch that failed to write is put back for the
+// next flush before it is dropped.
+const int kMaxPublisherInfoFlushRetries = 3;
+
+// Ledger and publisher state saves that arrive within this window are
+// coalesced into a single write of the latest state.
+constexpr base::TimeDelta kStateWriteInterval =
+    base::TimeDelta::FromSeconds(2);
+
+// The verified publishers list is several megabytes and keeps growing, so it
+// may be larger than the other ledger responses.
+const char kPublishersListPath[] = "/api/v1/public/channels";
+const size_t kMaxPublishersListSize = 64 * 1024 * 1024;
+
 time_t GetCurrentTimestamp() {
   return base::Time::NowFromSystemTime().ToTimeT();
 }
@@ -258,13 +337,30 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
       publisher_state_path_(profile_->GetPath().Append(kPublisher_state)),
       publisher_info_db_path_(profile->GetPath().Append(kPublisher_info_db)),
       publisher_list_path_(profile->GetPath().Append(kPublishers_list)),
+      ledger_state_writer_(new StateFileWriter(
+          ledger_state_path_, file_task_runner_, kStateWriteInterval)),
+      publisher_state_writer_(new StateFileWriter(
+          publisher_state_path_, file_task_runner_, kStateWriteInterval)),
       publisher_info_backend_(
           new PublisherInfoDatabase(publisher_info_db_path_)),
+      pending_publisher_info_(new PublisherActivityAccumulator()),
+      publisher_info_flush_failures_(0),
+      url_loader_pool_(new LedgerURLLoaderPool()),
+      ledger_timers_(new LedgerTimerQueue(base::BindRepeating(
+          &RewardsServiceImpl::OnTimer, base::Unretained(this)))),
       notification_service_(new RewardsNotificationServiceImpl(profile)),
 #if BUILDFLAG(ENABLE_EXTENSIONS)
       private_observer_(
           std::make_unique<ExtensionRewardsServiceObserver>(profile_)),
 #endif
+      balance_reports_valid_(false),
+      current_balance_report_month_(ledger::PUBLISHER_MONTH::ANY),
+      current_balance_report_year_(0),
+      recurring_donations_version_(0),
+      tips_month_(ledger::PUBLISHER_MONTH::ANY),
+      tips_year_(0),
+      tips_version_(0),
+      content_site_list_next_record_(0),
       next_timer_id_(0) {
   const base::CommandLine& command_line =
       *base::CommandLine::ForCurrentProcess();
@@ -307,6 +403,8 @@ void RewardsServiceImpl::Init() {
   AddObserver(extension_rewards_service_observer_.get());
   private_observers_.AddObserver(private_observer_.get());
 #endif
+  memory_pressure_listener_.reset(new base::MemoryPressureListener(
+      base::Bind(&RewardsServiceImpl::OnMemoryPressure, AsWeakPtr())));
   ledger_->Initialize();
 }
 
@@ -330,16 +428,55 @@ void RewardsServiceImpl::GetContentSiteList(
   filter.year = GetPublisherYear(now);
   filter.min_duration = ledger_->GetPublisherMinVisitTime();
   filter.order_by.push_back(std::pair<std::string, bool>("ai.percent", false));
+  // The order FindPage() uses, so paging by offset and by cursor agree.
+  filter.order_by.push_back(
+      std::pair<std::string, bool>("ai.publisher_id", false));
   filter.reconcile_stamp = ledger_->GetReconcileStamp();
   filter.excluded =
     ledger::PUBLISHER_EXCLUDE_FILTER::FILTER_ALL_EXCEPT_EXCLUDED;
 
-  ledger_->GetPublisherInfoList(start, limit,
-      filter,
-      std::bind(&GetContentSiteListInternal,
-                start,
-                limit,
-                callback, _1, _2));
+  PublisherInfoCursor after;
+  if (start > 0 && start == content_site_list_next_record_ &&
+      IsSameContentSiteListFilter(filter, content_site_list_filter_))
+    after = content_site_list_cursor_;
+
+  // Same filter the ledger would pass to LoadPublisherInfoList(), but read
+  // directly so rows and total come from a single transaction.
+  FlushPublisherInfo();
+  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
+      base::Bind(&LoadContentSiteListOnFileTaskRunner,
+                    start, limit, filter, after,
+                    publisher_info_backend_.get()),
+      base::Bind(&RewardsServiceImpl::OnContentSiteListLoaded,
+                    AsWeakPtr(),
+                    start,
+                    limit,
+                    filter,
+                    callback));
+}
+
+void RewardsServiceImpl::OnContentSiteListLoaded(
+    uint32_t start,
+    uint32_t limit,
+    const ledger::PublisherInfoFilter& filter,
+    const GetContentSiteListCallback& callback,
+    const ContentSiteListResult& result) {
+  std::unique_ptr<ContentSiteList> site_list(new ContentSiteList);
+  for (ledger::PublisherInfoList::const_iterator it =
+      result.list.begin(); it != result.list.end(); ++it) {
+    site_list->push_back(PublisherInfoToContentSite(*it));
+  }
+
+  // Knowing the total, there is only a next record when there really is one.
+  uint32_t next_record = 0;
+  if (limit > 0 && start + limit < static_cast<uint32_t>(result.count))
+    next_record = start + limit + 1;
+
+  content_site_list_next_record_ = result.next.valid ? next_record : 0;
+  content_site_list_cursor_ = result.next;
+  content_site_list_filter_ = filter;
+
+  callback.Run(std::move(site_list), next_record);
 }
 
 void RewardsServiceImpl::OnLoad(SessionID tab_id, const GURL& url) {
@@ -398,13 +535,9 @@ void RewardsServiceImpl::OnPostData(SessionID tab_id,
                                     const GURL& first_party_url,
                                     const GURL& referrer,
                                     const std::string& post_data) {
-  std::string output;
-  url::RawCanonOutputW<1024> canonOutput;
-  url::DecodeURLEscapeSequences(post_data.c_str(),
-                                post_data.length(),
-                                &canonOutput);
-  output = base::UTF16ToUTF8(base::StringPiece16(canonOutput.data(),
-                                                 canonOutput.length()));
+  // Unescape straight to UTF-8 bytes instead of going through UTF-16.
+  std::string output = net::UnescapeBinaryURLComponent(
+      post_data, net::UnescapeRule::NORMAL);
 
   if (output.empty())
     return;
@@ -455,6 +588,7 @@ void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
 void RewardsServiceImpl::LoadMediaPublisherInfo(
     const std::string& media_key,
     ledger::PublisherInfoCallback callback) {
+  FlushPublisherInfo();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&LoadMediaPublisherInfoListOnFileTaskRunner,
           media_key, publisher_info_backend_.get()),
@@ -477,7 +611,8 @@ void RewardsServiceImpl::OnMediaPublisherInfoLoaded(
 void RewardsServiceImpl::SaveMediaPublisherInfo(
     const std::string& media_key,
     const std::string& publisher_id) {
-base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
+  FlushPublisherInfo();
+  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&SaveMediaPublisherInfoOnFileTaskRunner,
                     media_key,
                     publisher_id,
@@ -515,16 +650,27 @@ void RewardsServiceImpl::Shutdown() {
 #endif
   BitmapFetcherService* image_service =
       BitmapFetcherServiceFactory::GetForBrowserContext(profile_);
+  // Cancelling reports the fetches as failed, nobody is left to tell.
+  favicon_fetches_.clear();
+  std::map<std::string, BitmapFetcherService::RequestId> request_ids;
+  request_ids.swap(request_ids_);
   if (image_service) {
-    for (auto request_id : request_ids_) {
-      image_service->CancelRequest(request_id);
+    for (const auto& request_id : request_ids) {
+      image_service->CancelRequest(request_id.second);
     }
   }
 
-  for (const auto fetcher : fetchers_) {
-    delete fetcher.first;
-  }
-  fetchers_.clear();
+  // Cancels the ledger's requests before the ledger goes away.
+  url_loader_pool_.reset();
+  ledger_timers_.reset();
+
+  // |file_task_runner_| blocks shutdown, so this is written before exit.
+  FlushPublisherInfo();
+  memory_pressure_listener_.reset();
+  // Destroying the writers still writes pending state, but drops the write
+  // replies, which would call back into |ledger_|.
+  ledger_state_writer_.reset();
+  publisher_state_writer_.reset();
 
   ledger_.reset();
   RewardsService::Shutdown();
@@ -545,6 +691,7 @@ void RewardsServiceImpl::OnWalletInitialized(ledger::Result result) {
 
 void RewardsServiceImpl::OnWalletProperties(ledger::Result result,
     std::unique_ptr<ledger::WalletInfo> wallet_info) {
+  InvalidateBalanceReports();
   TriggerOnWalletProperties(result, std::move(wallet_info));
 }
 
@@ -567,6 +714,7 @@ void RewardsServiceImpl::OnGrantCaptcha(const std::string& image, const std::str
 void RewardsServiceImpl::OnRecoverWallet(ledger::Result result,
                                     double balance,
                                     const std::vector<ledger::Grant>& grants) {
+  InvalidateBalanceReports();
   TriggerOnRecoverWallet(result, balance, grants);
 }
 
@@ -579,6 +727,7 @@ void RewardsServiceImpl::OnGrantFinish(ledger::Result result,
                                   GetPublisherYear(now),
                                   ledger::ReportType::GRANT,
                                   grant.probi);
+    InvalidateBalanceReports();
   }
 
   TriggerOnGrantFinish(result, grant);
@@ -616,6 +765,7 @@ void RewardsServiceImpl::OnReconcileComplete(ledger::Result result,
         GetPublisherMonth(now),
         GetPublisherYear(now),
         GetCurrentTimestamp());
+    InvalidateBalanceReports();
   }
 
   for (auto& observer : observers_)
@@ -624,6 +774,8 @@ void RewardsServiceImpl::OnReconcileComplete(ledger::Result result,
 
 void RewardsServiceImpl::LoadLedgerState(
     ledger::LedgerCallbackHandler* handler) {
+  // Reads are sequenced after the write, so they see the latest state.
+  ledger_state_writer_->Flush();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&LoadStateOnFileTaskRunner, ledger_state_path_),
       base::Bind(&RewardsServiceImpl::OnLedgerStateLoaded,
@@ -641,6 +793,8 @@ void RewardsServiceImpl::OnLedgerStateLoaded(
 
 void RewardsServiceImpl::LoadPublisherState(
     ledger::LedgerCallbackHandler* handler) {
+  // Reads are sequenced after the write, so they see the latest state.
+  publisher_state_writer_->Flush();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&LoadStateOnFileTaskRunner, publisher_state_path_),
       base::Bind(&RewardsServiceImpl::OnPublisherStateLoaded,
@@ -655,22 +809,14 @@ void RewardsServiceImpl::OnPublisherStateLoaded(
       data.empty() ? ledger::Result::NO_PUBLISHER_STATE
                    : ledger::Result::LEDGER_OK,
       data);
+  InvalidateBalanceReports();
 }
 
 void RewardsServiceImpl::SaveLedgerState(const std::string& ledger_state,
                                       ledger::LedgerCallbackHandler* handler) {
-  base::ImportantFileWriter writer(
-      ledger_state_path_, file_task_runner_);
-
-  writer.RegisterOnNextWriteCallbacks(
-      base::Closure(),
-      base::Bind(
-        &PostWriteCallback,
-        base::Bind(&RewardsServiceImpl::OnLedgerStateSaved, AsWeakPtr(),
-            base::Unretained(handler)),
-        base::SequencedTaskRunnerHandle::Get()));
-
-  writer.WriteNow(std::make_unique<std::string>(ledger_state));
+  ledger_state_writer_->Save(ledger_state,
+      base::BindOnce(&RewardsServiceImpl::OnLedgerStateSaved, AsWeakPtr(),
+          base::Unretained(handler)));
 }
 
 void RewardsServiceImpl::OnLedgerStateSaved(
@@ -682,17 +828,12 @@ void RewardsServiceImpl::OnLedgerStateSaved(
 
 void RewardsServiceImpl::SavePublisherState(const std::string& publisher_state,
                                       ledger::LedgerCallbackHandler* handler) {
-  base::ImportantFileWriter writer(publisher_state_path_, file_task_runner_);
-
-  writer.RegisterOnNextWriteCallbacks(
-      base::Closure(),
-      base::Bind(
-        &PostWriteCallback,
-        base::Bind(&RewardsServiceImpl::OnPublisherStateSaved, AsWeakPtr(),
-            base::Unretained(handler)),
-        base::SequencedTaskRunnerHandle::Get()));
-
-  writer.WriteNow(std::make_unique<std::string>(publisher_state));
+  // The balance reports are part of the publisher state, so any change to
+  // them is saved through here.
+  InvalidateBalanceReports();
+  publisher_state_writer_->Save(publisher_state,
+      base::BindOnce(&RewardsServiceImpl::OnPublisherStateSaved, AsWeakPtr(),
+          base::Unretained(handler)));
 }
 
 void RewardsServiceImpl::OnPublisherStateSaved(
@@ -718,31 +859,95 @@ void RewardsServiceImpl::LoadNicewareList(
 void RewardsServiceImpl::SavePublisherInfo(
     std::unique_ptr<ledger::PublisherInfo> publisher_info,
     ledger::PublisherInfoCallback callback) {
-  ledger::PublisherInfo info_copy = *publisher_info;
-  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
-      base::Bind(&SavePublisherInfoOnFileTaskRunner,
-                    info_copy,
-                    publisher_info_backend_.get()),
+  // Visit tracking saves every few seconds per tab, so writes are collected
+  // and flushed to the database in batches. Reads go through
+  // LoadPublisherInfo() and friends, which see the pending entries.
+  pending_publisher_info_->Add(*publisher_info);
+  if (pending_publisher_info_->size() >= kMaxPendingPublisherInfo) {
+    FlushPublisherInfo();
+  } else {
+    SchedulePublisherInfoFlush();
+  }
+
+  base::SequencedTaskRunnerHandle::Get()->PostTask(FROM_HERE,
       base::Bind(&RewardsServiceImpl::OnPublisherInfoSaved,
                      AsWeakPtr(),
                      callback,
                      base::Passed(std::move(publisher_info))));
-
 }
 
 void RewardsServiceImpl::OnPublisherInfoSaved(
     ledger::PublisherInfoCallback callback,
-    std::unique_ptr<ledger::PublisherInfo> info,
-    bool success) {
-  callback(success ? ledger::Result::LEDGER_OK
-                   : ledger::Result::LEDGER_ERROR, std::move(info));
+    std::unique_ptr<ledger::PublisherInfo> info) {
+  callback(ledger::Result::LEDGER_OK, std::move(info));
+}
+
+void RewardsServiceImpl::SchedulePublisherInfoFlush() {
+  if (publisher_info_flush_timer_.IsRunning())
+    return;
 
-  TriggerOnContentSiteUpdated();
+  publisher_info_flush_timer_.Start(FROM_HERE, kPublisherInfoFlushDelay,
+      base::Bind(&RewardsServiceImpl::FlushPublisherInfo,
+                 base::Unretained(this)));
+}
+
+void RewardsServiceImpl::FlushPublisherInfo() {
+  publisher_info_flush_timer_.Stop();
+  if (pending_publisher_info_->empty())
+    return;
+
+  ledger::PublisherInfoList list = pending_publisher_info_->Take();
+  // The lists show publisher details that may have just changed.
+  UpdatePublisherInfoLists(list);
+  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
+      base::Bind(&SavePublisherInfoListOnFileTaskRunner,
+                    std::move(list),
+                    publisher_info_backend_.get()),
+      base::Bind(&RewardsServiceImpl::OnPublisherInfoListSaved,
+                     AsWeakPtr()));
+}
+
+void RewardsServiceImpl::OnPublisherInfoListSaved(
+    const ledger::PublisherInfoList& unsaved) {
+  if (unsaved.empty()) {
+    publisher_info_flush_failures_ = 0;
+    TriggerOnContentSiteUpdated();
+    return;
+  }
+
+  // The ledger was already told the entries were saved, so keep them
+  // around for the next flush rather than losing its activity.
+  if (++publisher_info_flush_failures_ > kMaxPublisherInfoFlushRetries) {
+    LOG(ERROR) << "Error in OnPublisherInfoListSaved, dropping "
+               << unsaved.size() << " publisher info entries";
+    publisher_info_flush_failures_ = 0;
+    return;
+  }
+
+  LOG(ERROR) << "Error in OnPublisherInfoListSaved, retrying";
+  pending_publisher_info_->Restore(unsaved);
+  SchedulePublisherInfoFlush();
+}
+
+void RewardsServiceImpl::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
+  FlushPublisherInfo();
 }
 
 void RewardsServiceImpl::LoadPublisherInfo(
     ledger::PublisherInfoFilter filter,
     ledger::PublisherInfoCallback callback) {
+  ledger::PublisherInfo pending_info;
+  if (pending_publisher_info_->Find(filter, &pending_info)) {
+    base::SequencedTaskRunnerHandle::Get()->PostTask(FROM_HERE,
+        base::Bind(&RewardsServiceImpl::OnPublisherInfoLoaded,
+                       AsWeakPtr(),
+                       callback,
+                       ledger::PublisherInfoList(1, pending_info)));
+    return;
+  }
+
+  FlushPublisherInfo();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&LoadPublisherInfoListOnFileTaskRunner,
           // set limit to 2 to make sure there is
@@ -780,6 +985,7 @@ void RewardsServiceImpl::LoadPublisherInfoList(
   filter.year = GetPublisherYear(now);
   filter.reconcile_stamp = ledger_->GetReconcileStamp();
 
+  FlushPublisherInfo();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&LoadPublisherInfoListOnFileTaskRunner,
                     start, limit, filter,
@@ -796,6 +1002,7 @@ void RewardsServiceImpl::LoadCurrentPublisherInfoList(
     uint32_t limit,
     ledger::PublisherInfoFilter filter,
     ledger::PublisherInfoListCallback callback) {
+  FlushPublisherInfo();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&LoadPublisherInfoListOnFileTaskRunner,
                     start, limit, filter,
@@ -826,34 +1033,19 @@ std::unique_ptr<ledger::LedgerURLLoader> RewardsServiceImpl::LoadURL(
     const std::string& contentType,
     const ledger::URL_METHOD& method,
     ledger::LedgerCallbackHandler* handler) {
-  net::URLFetcher::RequestType request_type = URLMethodToRequestType(method);
-
-  net::URLFetcher* fetcher = net::URLFetcher::Create(
-      GURL(url), request_type, this).release();
-  fetcher->SetRequestContext(g_browser_process->system_request_context());
-
-  for (size_t i = 0; i < headers.size(); i++)
-    fetcher->AddExtraRequestHeader(headers[i]);
-
-  if (!content.empty())
-    fetcher->SetUploadData(contentType, content);
+  LedgerURLLoaderPool::Request request;
+  request.url = url;
+  request.method = URLMethodToRequestType(method);
+  request.headers = headers;
+  request.content = content;
+  request.content_type = contentType;
+  if (GURL(url).path() == kPublishersListPath)
+    request.max_response_size = kMaxPublishersListSize;
 
   if (VLOG_IS_ON(ledger::LogLevel::LOG_REQUEST)) {
-    std::string printMethod;
-    switch (method) {
-      case ledger::URL_METHOD::POST:
-        printMethod = "POST";
-        break;
-      case ledger::URL_METHOD::PUT:
-        printMethod = "PUT";
-        break;
-      default:
-        printMethod = "GET";
-        break;
-    }
     VLOG(ledger::LogLevel::LOG_REQUEST) << "[ REQUEST ]";
     VLOG(ledger::LogLevel::LOG_REQUEST) << "> url: " << url;
-    VLOG(ledger::LogLevel::LOG_REQUEST) << "> method: " << printMethod;
+    VLOG(ledger::LogLevel::LOG_REQUEST) << "> method: " << request.method;
     VLOG(ledger::LogLevel::LOG_REQUEST) << "> content: " << content;
     VLOG(ledger::LogLevel::LOG_REQUEST) << "> contentType: " << contentType;
     for (size_t i = 0; i < headers.size(); i++) {
@@ -862,54 +1054,19 @@ std::unique_ptr<ledger::LedgerURLLoader> RewardsServiceImpl::LoadURL(
     VLOG(ledger::LogLevel::LOG_REQUEST) << "[ END REQUEST ]";
   }
 
-  FetchCallback callback = base::Bind(
+  LedgerURLLoaderPool::ResponseCallback callback = base::Bind(
       &ledger::LedgerCallbackHandler::OnURLRequestResponse,
       base::Unretained(handler),
       next_id,
       url);
-  fetchers_[fetcher] = callback;
 
   std::unique_ptr<ledger::LedgerURLLoader> loader(
-      new LedgerURLLoaderImpl(next_id++, fetcher));
+      new LedgerURLLoaderImpl(next_id++, url_loader_pool_->AsWeakPtr(),
+                              request, callback));
 
   return loader;
 }
 
-void RewardsServiceImpl::OnURLFetchComplete(
-    const net::URLFetcher* source) {
-  if (fetchers_.find(source) == fetchers_.end()) {
-    delete source;
-    return;
-  }
-
-  auto callback = fetchers_[source];
-  fetchers_.erase(source);
-
-  int response_code = source->GetResponseCode();
-  std::string body;
-  std::map<std::string, std::string> headers;
-  scoped_refptr<net::HttpResponseHeaders> headersList = source->GetResponseHeaders();
-
-  if (headersList) {
-    size_t iter = 0;
-    std::string key;
-    std::string value;
-    while (headersList->EnumerateHeaderLines(&iter, &key, &value)) {
-      key = base::ToLowerASCII(key);
-      headers[key] = value;
-    }
-  }
-
-  if (response_code != net::URLFetcher::ResponseCode::RESPONSE_CODE_INVALID &&
-      source->GetStatus().is_success()) {
-    source->GetResponseAsString(&body);
-  }
-
-  delete source;
-
-  callback.Run(response_code, body, headers);
-}
-
 void RunIOTaskCallback(
     base::WeakPtr<RewardsServiceImpl> rewards_service,
     std::function<void(void)> callback) {
@@ -1103,18 +1260,11 @@ void RewardsServiceImpl::TriggerOnContentSiteUpdated() {
 
 void RewardsServiceImpl::SavePublishersList(const std::string& publishers_list,
                                       ledger::LedgerCallbackHandler* handler) {
-  base::ImportantFileWriter writer(
-      publisher_list_path_, file_task_runner_);
-
-  writer.RegisterOnNextWriteCallbacks(
-      base::Closure(),
-      base::Bind(
-        &PostWriteCallback,
-        base::Bind(&RewardsServiceImpl::OnPublishersListSaved, AsWeakPtr(),
-            base::Unretained(handler)),
-        base::SequencedTaskRunnerHandle::Get()));
-
-  writer.WriteNow(std::make_unique<std::string>(publishers_list));
+  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
+      base::Bind(&SavePublishersListOnFileTaskRunner,
+          publisher_list_path_, publishers_list),
+      base::Bind(&RewardsServiceImpl::OnPublishersListSaved, AsWeakPtr(),
+          base::Unretained(handler)));
 }
 
 void RewardsServiceImpl::OnPublishersListSaved(
@@ -1133,16 +1283,11 @@ void RewardsServiceImpl::SetTimer(uint64_t time_offset,
 
   timer_id = next_timer_id_;
 
-  timers_[next_timer_id_] = std::make_unique<base::OneShotTimer>();
-  timers_[next_timer_id_]->Start(FROM_HERE,
-      base::TimeDelta::FromSeconds(time_offset),
-      base::BindOnce(
-          &RewardsServiceImpl::OnTimer, AsWeakPtr(), next_timer_id_));
+  ledger_timers_->Add(timer_id, base::TimeDelta::FromSeconds(time_offset));
 }
 
 void RewardsServiceImpl::OnTimer(uint32_t timer_id) {
   ledger_->OnTimer(timer_id);
-  timers_.erase(timer_id);
 }
 
 void RewardsServiceImpl::LoadPublisherList(
@@ -1164,6 +1309,9 @@ void RewardsServiceImpl::OnPublisherListLoaded(
 }
 
 std::map<std::string, brave_rewards::BalanceReport> RewardsServiceImpl::GetAllBalanceReports() {
+  if (balance_reports_valid_)
+    return balance_reports_;
+
   std::map<std::string, ledger::BalanceReportInfo> reports = ledger_->GetAllBalanceReports();
 
   std::map<std::string, brave_rewards::BalanceReport> newReports;
@@ -1181,19 +1329,37 @@ std::map<std::string, brave_rewards::BalanceReport> RewardsServiceImpl::GetAllBa
     newReports[report.first] = newReport;
   }
 
-  return newReports;
+  balance_reports_.swap(newReports);
+  balance_reports_valid_ = true;
+  return balance_reports_;
 }
 
 void RewardsServiceImpl::GetCurrentBalanceReport() {
-  ledger::BalanceReportInfo report;
   auto now = base::Time::Now();
-  bool success = ledger_->GetBalanceReport(GetPublisherMonth(now),
-                                           GetPublisherYear(now), &report);
+  const ledger::PUBLISHER_MONTH month = GetPublisherMonth(now);
+  const int year = GetPublisherYear(now);
+  if (current_balance_report_ && current_balance_report_month_ == month &&
+      current_balance_report_year_ == year) {
+    TriggerOnGetCurrentBalanceReport(*current_balance_report_);
+    return;
+  }
+
+  ledger::BalanceReportInfo report;
+  bool success = ledger_->GetBalanceReport(month, year, &report);
   if (success) {
+    current_balance_report_.reset(new ledger::BalanceReportInfo(report));
+    current_balance_report_month_ = month;
+    current_balance_report_year_ = year;
     TriggerOnGetCurrentBalanceReport(report);
   }
 }
 
+void RewardsServiceImpl::InvalidateBalanceReports() {
+  balance_reports_valid_ = false;
+  balance_reports_.clear();
+  current_balance_report_.reset();
+}
+
 bool RewardsServiceImpl::IsWalletCreated() {
   return ledger_->IsWalletCreated();
 }
@@ -1258,13 +1424,44 @@ void RewardsServiceImpl::FetchFavIcon(const std::string& url,
     return;
   }
 
-  std::vector<std::string>::iterator it;
-  it = find (current_media_fetchers_.begin(), current_media_fetchers_.end(), url);
-  if (it != current_media_fetchers_.end()) {
-    LOG(WARNING) << "Already fetching favicon: " << url;
+  // Callers asking for a favicon that is already being looked up share the
+  // result instead of being dropped.
+  auto it = favicon_fetches_.find(favicon_key);
+  if (it != favicon_fetches_.end()) {
+    it->second.push_back(callback);
+    return;
+  }
+  favicon_fetches_[favicon_key].push_back(callback);
+
+  // The favicon saved by an earlier fetch, possibly in an earlier session,
+  // is served without going to the network.
+  favicon::FaviconService* favicon_service =
+      FaviconServiceFactory::GetForProfile(profile_,
+                                           ServiceAccessType::EXPLICIT_ACCESS);
+  favicon_service->GetRawFaviconForPageURL(
+      GURL(favicon_key),
+      {favicon_base::IconType::kFavicon},
+      0,
+      false,
+      base::Bind(&RewardsServiceImpl::OnFavIconCacheChecked, AsWeakPtr(),
+          url, favicon_key),
+      &favicon_task_tracker_);
+}
+
+void RewardsServiceImpl::OnFavIconCacheChecked(
+    const std::string& url,
+    const std::string& favicon_key,
+    const favicon_base::FaviconRawBitmapResult& result) {
+  if (result.is_valid()) {
+    // On-demand favicons are evicted unless they are used.
+    FaviconServiceFactory::GetForProfile(profile_,
+                                         ServiceAccessType::EXPLICIT_ACCESS)
+        ->TouchOnDemandFavicon(result.icon_url);
+    OnSetOnDemandFaviconComplete(favicon_key, true);
     return;
   }
 
+  GURL parsedUrl(url);
   BitmapFetcherService* image_service =
       BitmapFetcherServiceFactory::GetForBrowserContext(profile_);
   if (image_service) {
@@ -1287,20 +1484,25 @@ void RewardsServiceImpl::FetchFavIcon(const std::string& url,
           policy_exception_justification:
             "Not implemented."
         })");
-    current_media_fetchers_.emplace_back(url);
-    request_ids_.push_back(image_service->RequestImage(
+    BitmapFetcherService::RequestId request_id = image_service->RequestImage(
           parsedUrl,
           // Image Service takes ownership of the observer
           new RewardsFetcherServiceObserver(
               favicon_key,
               parsedUrl,
-              base::Bind(&RewardsServiceImpl::OnFetchFavIconCompleted, base::Unretained(this), callback)),
-          traffic_annotation));
+              base::Bind(&RewardsServiceImpl::OnFetchFavIconCompleted, base::Unretained(this)),
+              base::Bind(&RewardsServiceImpl::OnFetchFavIconFailed, base::Unretained(this))),
+          traffic_annotation);
+    // Cached images and requests that can't be started are answered right
+    // away and have no id.
+    if (request_id != BitmapFetcherService::REQUEST_ID_INVALID)
+      request_ids_[favicon_key] = request_id;
+  } else {
+    OnSetOnDemandFaviconComplete(favicon_key, false);
   }
 }
 
-void RewardsServiceImpl::OnFetchFavIconCompleted(ledger::FetchIconCallback callback,
-                                                 const std::string& favicon_key,
+void RewardsServiceImpl::OnFetchFavIconCompleted(const std::string& favicon_key,
                                                  const GURL& url,
                                                  const BitmapFetcherService::RequestId& request_id,
                                                  const SkBitmap& image) {
@@ -1313,25 +1515,28 @@ void RewardsServiceImpl::OnFetchFavIconCompleted(ledger::FetchIconCallback callb
       url,
       favicon_base::IconType::kFavicon,
       gfx_image,
-      base::BindOnce(&RewardsServiceImpl::OnSetOnDemandFaviconComplete, AsWeakPtr(), favicon_url.spec(), callback));
+      base::BindOnce(&RewardsServiceImpl::OnSetOnDemandFaviconComplete, AsWeakPtr(), favicon_key));
 
-  std::vector<std::string>::iterator it_url;
-  it_url = find(current_media_fetchers_.begin(), current_media_fetchers_.end(), url.spec());
-  if (it_url != current_media_fetchers_.end()) {
-    current_media_fetchers_.erase(it_url);
-  }
+  request_ids_.erase(favicon_key);
+}
 
-  std::vector<BitmapFetcherService::RequestId>::iterator it_ids;
-  it_ids = find(request_ids_.begin(), request_ids_.end(), request_id);
-  if (it_ids != request_ids_.end()) {
-    request_ids_.erase(it_ids);
-  }
+void RewardsServiceImpl::OnFetchFavIconFailed(const std::string& favicon_key) {
+  request_ids_.erase(favicon_key);
+  OnSetOnDemandFaviconComplete(favicon_key, false);
 }
 
-void RewardsServiceImpl::OnSetOnDemandFaviconComplete(const std::string& favicon_url,
-                                                      ledger::FetchIconCallback callback,
+void RewardsServiceImpl::OnSetOnDemandFaviconComplete(const std::string& favicon_key,
                                                       bool success) {
-  callback(success, favicon_url);
+  auto it = favicon_fetches_.find(favicon_key);
+  if (it == favicon_fetches_.end())
+    return;
+
+  std::vector<ledger::FetchIconCallback> callbacks;
+  callbacks.swap(it->second);
+  favicon_fetches_.erase(it);
+  const std::string favicon_url = GURL(favicon_key).spec();
+  for (const auto& callback : callbacks)
+    callback(success, favicon_url);
 }
 
 void RewardsServiceImpl::GetPublisherBanner(const std::string& publisher_id) {
@@ -1373,16 +1578,39 @@ void RewardsServiceImpl::OnDonate(const std::string& publisher_key, int amount,
   ledger_->DoDirectDonation(publisher_info, amount, "BAT");
 }
 
-bool SaveContributionInfoOnFileTaskRunner(const brave_rewards::ContributionInfo info,
-  PublisherInfoDatabase* backend) {
-  if (backend && backend->InsertContributionInfo(info))
-    return true;
+std::unique_ptr<ledger::PublisherInfo> SaveContributionInfoOnFileTaskRunner(
+    const brave_rewards::ContributionInfo info,
+    PublisherInfoDatabase* backend) {
+  if (!backend || !backend->InsertContributionInfo(info))
+    return nullptr;
 
-  return false;
+  // The tips list shows the publisher's details next to the contribution.
+  return backend->GetPublisherInfo(info.publisher_key);
 }
 
-void RewardsServiceImpl::OnContributionInfoSaved(const ledger::PUBLISHER_CATEGORY category, bool success) {
-  if (success && category == ledger::PUBLISHER_CATEGORY::DIRECT_DONATION) {
+void RewardsServiceImpl::OnContributionInfoSaved(
+    const brave_rewards::ContributionInfo& info,
+    std::unique_ptr<ledger::PublisherInfo> publisher) {
+  if (info.category != ledger::PUBLISHER_CATEGORY::DIRECT_DONATION &&
+      info.category != ledger::PUBLISHER_CATEGORY::TIPPING)
+    return;
+
+  ++tips_version_;
+  if (!publisher) {
+    // Either the save failed or the publisher is not stored, so the cached
+    // list can't be patched; read it again.
+    current_tips_ = nullptr;
+  } else if (current_tips_ && static_cast<int>(tips_month_) == info.month &&
+      tips_year_ == info.year) {
+    publisher->weight = 0;
+    base::StringToDouble(info.probi, &publisher->weight);
+    publisher->reconcile_stamp = info.date;
+    ledger::PublisherInfoList list(current_tips_->data);
+    list.push_back(*publisher);
+    current_tips_ = MakePublisherInfoListSnapshot(std::move(list));
+  }
+
+  if (info.category == ledger::PUBLISHER_CATEGORY::DIRECT_DONATION) {
     TipsUpdated();
   }
 }
@@ -1402,27 +1630,47 @@ void RewardsServiceImpl::SaveContributionInfo(const std::string& probi,
   info.publisher_key = publisher_key;
   info.category = category;
 
+  // The tips list is read back with the publisher's details, which may
+  // still be waiting in |pending_publisher_info_|.
+  FlushPublisherInfo();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&SaveContributionInfoOnFileTaskRunner,
                     info,
                     publisher_info_backend_.get()),
       base::Bind(&RewardsServiceImpl::OnContributionInfoSaved,
                      AsWeakPtr(),
-                     category));
+                     info));
 }
 
-bool SaveRecurringDonationOnFileTaskRunner(const brave_rewards::RecurringDonation info,
-  PublisherInfoDatabase* backend) {
-  if (backend && backend->InsertOrUpdateRecurringDonation(info))
-    return true;
-
-  return false;
-}
-
-void RewardsServiceImpl::OnRecurringDonationSaved(bool success) {
-  if (success) {
-    UpdateRecurringDonationsList();
+std::unique_ptr<ledger::PublisherInfo> SaveRecurringDonationOnFileTaskRunner(
+    const brave_rewards::RecurringDonation info,
+    PublisherInfoDatabase* backend) {
+  if (!backend || !backend->InsertOrUpdateRecurringDonation(info))
+    return nullptr;
+
+  return backend->GetPublisherInfo(info.publisher_key);
+}
+
+void RewardsServiceImpl::OnRecurringDonationSaved(
+    const brave_rewards::RecurringDonation& info,
+    std::unique_ptr<ledger::PublisherInfo> publisher) {
+  ++recurring_donations_version_;
+  if (!publisher) {
+    recurring_donations_ = nullptr;
+  } else if (recurring_donations_) {
+    publisher->weight = info.amount;
+    publisher->reconcile_stamp = info.added_date;
+    // INSERT OR REPLACE moves the donation to the end of the table.
+    ledger::PublisherInfoList list;
+    for (const auto& donation : recurring_donations_->data) {
+      if (donation.id != publisher->id)
+        list.push_back(donation);
+    }
+    list.push_back(*publisher);
+    recurring_donations_ = MakePublisherInfoListSnapshot(std::move(list));
   }
+
+  UpdateRecurringDonationsList();
 }
 
 void RewardsServiceImpl::SaveRecurringDonation(const std::string& publisher_key, const int amount) {
@@ -1431,38 +1679,62 @@ void RewardsServiceImpl::SaveRecurringDonation(const std::string& publisher_key,
   info.amount = amount;
   info.added_date = GetCurrentTimestamp();
 
+  FlushPublisherInfo();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&SaveRecurringDonationOnFileTaskRunner,
                     info,
                     publisher_info_backend_.get()),
       base::Bind(&RewardsServiceImpl::OnRecurringDonationSaved,
-                     AsWeakPtr()));
+                     AsWeakPtr(),
+                     info));
 
 }
 
-ledger::PublisherInfoList GetRecurringDonationsOnFileTaskRunner(PublisherInfoDatabase* backend) {
+PublisherInfoListSnapshot GetRecurringDonationsOnFileTaskRunner(
+    PublisherInfoDatabase* backend) {
   ledger::PublisherInfoList list;
-  if (!backend) {
-    return list;
+  if (backend) {
+    backend->GetRecurringDonations(&list);
   }
 
-  backend->GetRecurringDonations(&list);
+  return MakePublisherInfoListSnapshot(std::move(list));
+}
 
-  return list;
+void RewardsServiceImpl::OnRecurringDonationsLoaded(
+    const ledger::PublisherInfoListCallback callback,
+    uint64_t version,
+    const PublisherInfoListSnapshot& recurring_donations) {
+  // Keep the list unless it changed while it was being read.
+  if (version == recurring_donations_version_)
+    recurring_donations_ = recurring_donations;
+
+  OnRecurringDonationsData(callback, recurring_donations);
 }
 
 void RewardsServiceImpl::OnRecurringDonationsData(const ledger::PublisherInfoListCallback callback,
-                                                  const ledger::PublisherInfoList list) {
-  callback(list, 0);
+                                                  const PublisherInfoListSnapshot& recurring_donations) {
+  callback(recurring_donations->data, 0);
 }
 
 void RewardsServiceImpl::GetRecurringDonations(ledger::PublisherInfoListCallback callback) {
+  if (recurring_donations_) {
+    // Still answer asynchronously, as the ledger got used to.
+    base::SequencedTaskRunnerHandle::Get()->PostTask(FROM_HERE,
+        base::Bind(&RewardsServiceImpl::OnRecurringDonationsData,
+                       AsWeakPtr(),
+                       callback,
+                       recurring_donations_));
+    return;
+  }
+
+  FlushPublisherInfo();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&GetRecurringDonationsOnFileTaskRunner,
                     publisher_info_backend_.get()),
-      base::Bind(&RewardsServiceImpl::OnRecurringDonationsData,
+      base::Bind(&RewardsServiceImpl::OnRecurringDonationsLoaded,
                      AsWeakPtr(),
-                     callback));
+                     callback,
+                     recurring_donations_version_));
 
 }
 
@@ -1488,22 +1760,35 @@ void RewardsServiceImpl::OnRecurringDonationUpdated(const ledger::PublisherInfoL
   }
 }
 
-ledger::PublisherInfoList TipsUpdatedOnFileTaskRunner(PublisherInfoDatabase* backend) {
+PublisherInfoListSnapshot TipsUpdatedOnFileTaskRunner(
+    PublisherInfoDatabase* backend,
+    ledger::PUBLISHER_MONTH month,
+    int year) {
   ledger::PublisherInfoList list;
-  if (!backend) {
-    return list;
+  if (backend) {
+    backend->GetTips(&list, month, year);
   }
 
-  auto now = base::Time::Now();
-  backend->GetTips(&list, GetPublisherMonth(now), GetPublisherYear(now));
+  return MakePublisherInfoListSnapshot(std::move(list));
+}
 
-  return list;
+void RewardsServiceImpl::OnTipsLoaded(ledger::PUBLISHER_MONTH month,
+                                      int year,
+                                      uint64_t version,
+                                      const PublisherInfoListSnapshot& tips) {
+  if (version == tips_version_) {
+    current_tips_ = tips;
+    tips_month_ = month;
+    tips_year_ = year;
+  }
+
+  OnTipsUpdatedData(tips);
 }
 
-void RewardsServiceImpl::OnTipsUpdatedData(const ledger::PublisherInfoList list) {
+void RewardsServiceImpl::OnTipsUpdatedData(const PublisherInfoListSnapshot& tips) {
   brave_rewards::ContentSiteList new_list;
 
-  for (auto &publisher : list) {
+  for (auto &publisher : tips->data) {
     brave_rewards::ContentSite site = PublisherInfoToContentSite(publisher);
     site.percentage = publisher.weight;
     new_list.push_back(site);
@@ -1519,12 +1804,41 @@ void RewardsServiceImpl::RemoveRecurring(const std::string& publisher_key) {
 }
 
 void RewardsServiceImpl::TipsUpdated() {
+  auto now = base::Time::Now();
+  const ledger::PUBLISHER_MONTH month = GetPublisherMonth(now);
+  const int year = GetPublisherYear(now);
+  if (current_tips_ && tips_month_ == month && tips_year_ == year) {
+    OnTipsUpdatedData(current_tips_);
+    return;
+  }
+
+  FlushPublisherInfo();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&TipsUpdatedOnFileTaskRunner,
-                    publisher_info_backend_.get()),
-      base::Bind(&RewardsServiceImpl::OnTipsUpdatedData,
-                     AsWeakPtr()));
+                    publisher_info_backend_.get(),
+                    month,
+                    year),
+      base::Bind(&RewardsServiceImpl::OnTipsLoaded,
+                     AsWeakPtr(),
+                     month,
+                     year,
+                     tips_version_));
+
+}
+
+void RewardsServiceImpl::UpdatePublisherInfoLists(
+    const ledger::PublisherInfoList& publishers) {
+  if (!recurring_donations_ && !current_tips_)
+    return;
+
+  std::map<std::string, const ledger::PublisherInfo*> publishers_by_id;
+  for (const auto& publisher : publishers)
+    publishers_by_id[publisher.id] = &publisher;
 
+  if (UpdatePublisherInfoListSnapshot(publishers_by_id, &recurring_donations_))
+    ++recurring_donations_version_;
+  if (UpdatePublisherInfoListSnapshot(publishers_by_id, &current_tips_))
+    ++tips_version_;
 }
 
 bool RemoveRecurringOnFileTaskRunner(const std::string publisher_key, PublisherInfoDatabase* backend) {
@@ -1535,7 +1849,21 @@ bool RemoveRecurringOnFileTaskRunner(const std::string publisher_key, PublisherI
   return backend->RemoveRecurring(publisher_key);
 }
 
-void RewardsServiceImpl::OnRemovedRecurring(ledger::RecurringRemoveCallback callback, bool success) {
+void RewardsServiceImpl::OnRemovedRecurring(const std::string& publisher_key,
+                                            ledger::RecurringRemoveCallback callback,
+                                            bool success) {
+  if (success) {
+    ++recurring_donations_version_;
+    if (recurring_donations_) {
+      ledger::PublisherInfoList list;
+      for (const auto& donation : recurring_donations_->data) {
+        if (donation.id != publisher_key)
+          list.push_back(donation);
+      }
+      recurring_donations_ = MakePublisherInfoListSnapshot(std::move(list));
+    }
+  }
+
   callback(success ? ledger::Result::LEDGER_OK : ledger::Result::LEDGER_ERROR);
   UpdateRecurringDonationsList();
 }
@@ -1547,7 +1875,7 @@ void RewardsServiceImpl::OnRemoveRecurring(const std::string& publisher_key,
                     publisher_key,
                     publisher_info_backend_.get()),
       base::Bind(&RewardsServiceImpl::OnRemovedRecurring,
-                     AsWeakPtr(), callback));
+                     AsWeakPtr(), publisher_key, callback));
 }
 
 void RewardsServiceImpl::TriggerOnGetCurrentBalanceReport(
@@ -9,11 +9,17 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "bat/ledger/ledger.h"
+#include "bat/ledger/publisher_info.h"
 #include "bat/ledger/wallet_info.h"
 #include "base/files/file_path.h"
+#include "base/memory/memory_pressure_listener.h"
+#include "base/memory/ref_counted.h"
 #include "base/observer_list.h"
+#include "base/task/cancelable_task_tracker.h"
 #include "base/memory/weak_ptr.h"
 #include "base/timer/timer.h"
 #include "bat/ledger/ledger_client.h"
@@ -22,11 +28,12 @@
 #include "content/public/browser/browser_thread.h"
 #include "extensions/buildflags/buildflags.h"
 #include "extensions/common/one_shot_event.h"
-#include "net/url_request/url_fetcher_delegate.h"
 #include "brave/components/brave_rewards/browser/balance_report.h"
 #include "brave/components/brave_rewards/browser/contribution_info.h"
+#include "brave/components/brave_rewards/browser/recurring_donation.h"
 #include "ui/gfx/image/image.h"
 #include "brave/components/brave_rewards/browser/publisher_banner.h"
+#include "brave/components/brave_rewards/browser/publisher_info_database.h"
 #include "brave/components/brave_rewards/browser/rewards_service_private_observer.h"
 
 #if BUILDFLAG(ENABLE_EXTENSIONS)
@@ -37,6 +44,10 @@ namespace base {
 class SequencedTaskRunner;
 }  // namespace base
 
+namespace favicon_base {
+struct FaviconRawBitmapResult;
+}  // namespace favicon_base
+
 namespace ledger {
 class Ledger;
 class LedgerCallbackHandler;
@@ -47,20 +58,30 @@ namespace leveldb {
 class DB;
 }  // namespace leveldb
 
-namespace net {
-class URLFetcher;
-}  // namespace net
-
 class Profile;
 
 namespace brave_rewards {
 
-class PublisherInfoDatabase;
+class LedgerTimerQueue;
+class LedgerURLLoaderPool;
+class PublisherActivityAccumulator;
 class RewardsNotificationService;
+class StateFileWriter;
+
+// Immutable publisher list shared by the cache and its readers.
+using PublisherInfoListSnapshot =
+    scoped_refptr<const base::RefCountedData<ledger::PublisherInfoList>>;
+
+// A page of the content site list as read on the file task runner.
+struct ContentSiteListResult {
+  ledger::PublisherInfoList list;
+  int count = 0;
+  // Set when the page was read with PublisherInfoDatabase::FindPage().
+  PublisherInfoCursor next;
+};
 
 class RewardsServiceImpl : public RewardsService,
                             public ledger::LedgerClient,
-                            public net::URLFetcherDelegate,
                             public base::SupportsWeakPtr<RewardsServiceImpl> {
  public:
   RewardsServiceImpl(Profile* profile);
@@ -125,7 +146,6 @@ class RewardsServiceImpl : public RewardsService,
   friend void RunIOTaskCallback(
       base::WeakPtr<RewardsServiceImpl>,
       std::function<void(void)>);
-  typedef base::Callback<void(int, const std::string&, const std::map<std::string, std::string>& headers)> FetchCallback;
 
   const extensions::OneShotEvent& ready() const { return ready_; }
   void OnLedgerStateSaved(ledger::LedgerCallbackHandler* handler,
@@ -147,13 +167,22 @@ class RewardsServiceImpl : public RewardsService,
                               const std::vector<ledger::Grant>& grants);
   void TriggerOnGrantFinish(ledger::Result result, const ledger::Grant& grant);
   void OnPublisherInfoSaved(ledger::PublisherInfoCallback callback,
-                            std::unique_ptr<ledger::PublisherInfo> info,
-                            bool success);
+                            std::unique_ptr<ledger::PublisherInfo> info);
+  void SchedulePublisherInfoFlush();
+  void FlushPublisherInfo();
+  void OnPublisherInfoListSaved(const ledger::PublisherInfoList& unsaved);
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
   void OnPublisherInfoLoaded(ledger::PublisherInfoCallback callback,
                              const ledger::PublisherInfoList list);
   void OnMediaPublisherInfoSaved(bool success);
   void OnMediaPublisherInfoLoaded(ledger::PublisherInfoCallback callback,
                              std::unique_ptr<ledger::PublisherInfo> info);
+  void OnContentSiteListLoaded(uint32_t start,
+                               uint32_t limit,
+                               const ledger::PublisherInfoFilter& filter,
+                               const GetContentSiteListCallback& callback,
+                               const ContentSiteListResult& result);
   void OnPublisherInfoListLoaded(uint32_t start,
                                  uint32_t limit,
                                  ledger::PublisherInfoListCallback callback,
@@ -165,17 +194,33 @@ class RewardsServiceImpl : public RewardsService,
   void OnPublisherListLoaded(ledger::LedgerCallbackHandler* handler,
                              const std::string& data);
   void OnDonate(const std::string& publisher_key, int amount, bool recurring) override;
-  void OnContributionInfoSaved(const ledger::PUBLISHER_CATEGORY category, bool success);
-  void OnRecurringDonationSaved(bool success);
+  void OnContributionInfoSaved(
+      const brave_rewards::ContributionInfo& info,
+      std::unique_ptr<ledger::PublisherInfo> publisher);
+  void OnRecurringDonationSaved(
+      const brave_rewards::RecurringDonation& info,
+      std::unique_ptr<ledger::PublisherInfo> publisher);
   void SaveRecurringDonation(const std::string& publisher_key, const int amount);
+  void OnRecurringDonationsLoaded(
+      const ledger::PublisherInfoListCallback callback,
+      uint64_t version,
+      const PublisherInfoListSnapshot& recurring_donations);
   void OnRecurringDonationsData(const ledger::PublisherInfoListCallback callback,
-                                const ledger::PublisherInfoList list);
+                                const PublisherInfoListSnapshot& recurring_donations);
   void OnRecurringDonationUpdated(const ledger::PublisherInfoList& list);
-  void OnTipsUpdatedData(const ledger::PublisherInfoList list);
+  void OnTipsLoaded(ledger::PUBLISHER_MONTH month,
+                    int year,
+                    uint64_t version,
+                    const PublisherInfoListSnapshot& tips);
+  void OnTipsUpdatedData(const PublisherInfoListSnapshot& tips);
   void TipsUpdated();
-  void OnRemovedRecurring(ledger::RecurringRemoveCallback callback, bool success);
+  void UpdatePublisherInfoLists(const ledger::PublisherInfoList& publishers);
+  void OnRemovedRecurring(const std::string& publisher_key,
+                          ledger::RecurringRemoveCallback callback,
+                          bool success);
   void OnRemoveRecurring(const std::string& publisher_key, ledger::RecurringRemoveCallback callback) override;
   void TriggerOnGetCurrentBalanceReport(const ledger::BalanceReportInfo& report);
+  void InvalidateBalanceReports();
   void TriggerOnGetPublisherActivityFromUrl(
       ledger::Result result,
       std::unique_ptr<ledger::PublisherInfo> info,
@@ -246,13 +291,16 @@ class RewardsServiceImpl : public RewardsService,
   void FetchFavIcon(const std::string& url,
                     const std::string& favicon_key,
                     ledger::FetchIconCallback callback) override;
-  void OnFetchFavIconCompleted(ledger::FetchIconCallback callback,
-                          const std::string& favicon_key,
+  void OnFavIconCacheChecked(
+      const std::string& url,
+      const std::string& favicon_key,
+      const favicon_base::FaviconRawBitmapResult& result);
+  void OnFetchFavIconCompleted(const std::string& favicon_key,
                           const GURL& url,
                           const BitmapFetcherService::RequestId& request_id,
                           const SkBitmap& image);
-  void OnSetOnDemandFaviconComplete(const std::string& favicon_url,
-                                    ledger::FetchIconCallback callback,
+  void OnFetchFavIconFailed(const std::string& favicon_key);
+  void OnSetOnDemandFaviconComplete(const std::string& favicon_key,
                                     bool success);
   void SaveContributionInfo(const std::string& probi,
                             const int month,
@@ -265,9 +313,6 @@ class RewardsServiceImpl : public RewardsService,
 
   void OnIOTaskComplete(std::function<void(void)> callback);
 
-  // URLFetcherDelegate impl
-  void OnURLFetchComplete(const net::URLFetcher* source) override;
-
   Profile* profile_;  // NOT OWNED
   std::unique_ptr<ledger::Ledger> ledger_;
 #if BUILDFLAG(ENABLE_EXTENSIONS)
@@ -279,7 +324,18 @@ class RewardsServiceImpl : public RewardsService,
   const base::FilePath publisher_state_path_;
   const base::FilePath publisher_info_db_path_;
   const base::FilePath publisher_list_path_;
+  std::unique_ptr<StateFileWriter> ledger_state_writer_;
+  std::unique_ptr<StateFileWriter> publisher_state_writer_;
   std::unique_ptr<PublisherInfoDatabase> publisher_info_backend_;
+  // Publisher info saved by the ledger that is not written to
+  // |publisher_info_backend_| yet.
+  std::unique_ptr<PublisherActivityAccumulator> pending_publisher_info_;
+  base::OneShotTimer publisher_info_flush_timer_;
+  // Consecutive flushes that failed to write and were put back.
+  int publisher_info_flush_failures_;
+  std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
+  std::unique_ptr<LedgerURLLoaderPool> url_loader_pool_;
+  std::unique_ptr<LedgerTimerQueue> ledger_timers_;
   std::unique_ptr<RewardsNotificationService> notification_service_;
   base::ObserverList<RewardsServicePrivateObserver> private_observers_;
 #if BUILDFLAG(ENABLE_EXTENSIONS)
@@ -287,10 +343,34 @@ class RewardsServiceImpl : public RewardsService,
 #endif
 
   extensions::OneShotEvent ready_;
-  std::map<const net::URLFetcher*, FetchCallback> fetchers_;
-  std::map<uint32_t, std::unique_ptr<base::OneShotTimer>> timers_;
-  std::vector<std::string> current_media_fetchers_;
-  std::vector<BitmapFetcherService::RequestId> request_ids_;
+  // Callers waiting for each favicon that is being looked up, by key.
+  std::unordered_map<std::string, std::vector<ledger::FetchIconCallback>>
+      favicon_fetches_;
+  // Favicon fetches in flight on BitmapFetcherService, by favicon key.
+  std::map<std::string, BitmapFetcherService::RequestId> request_ids_;
+  base::CancelableTaskTracker favicon_task_tracker_;
+  // Balance reports as of the last ledger state change, rebuilt on demand
+  // after InvalidateBalanceReports().
+  bool balance_reports_valid_;
+  std::map<std::string, brave_rewards::BalanceReport> balance_reports_;
+  std::unique_ptr<ledger::BalanceReportInfo> current_balance_report_;
+  ledger::PUBLISHER_MONTH current_balance_report_month_;
+  int current_balance_report_year_;
+  // Recurring donations and this month's tips as last read from
+  // |publisher_info_backend_|, kept up to date as they are saved and
+  // removed. The versions change with every update so that a read that
+  // raced with one is not cached.
+  PublisherInfoListSnapshot recurring_donations_;
+  uint64_t recurring_donations_version_;
+  PublisherInfoListSnapshot current_tips_;
+  ledger::PUBLISHER_MONTH tips_month_;
+  int tips_year_;
+  uint64_t tips_version_;
+  // Where the last page of GetContentSiteList() ended, so that asking for
+  // the page after it seeks past its last row instead of skipping rows.
+  uint32_t content_site_list_next_record_;
+  PublisherInfoCursor content_site_list_cursor_;
+  ledger::PublisherInfoFilter content_site_list_filter_;
 
   uint32_t next_timer_id_;
 
@@ -0,0 +1,87 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/state_file_writer.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/files/file_path.h"
+#include "base/metrics/histogram_macros.h"
+#include "base/sequenced_task_runner.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+
+namespace brave_rewards {
+
+namespace {
+
+// Runs on the file task runner, so bounce back to the sequence that owns
+// the writer.
+void PostWriteDone(
+    scoped_refptr<base::SequencedTaskRunner> reply_task_runner,
+    const base::Callback<void(bool success)>& callback,
+    bool success) {
+  reply_task_runner->PostTask(FROM_HERE, base::Bind(callback, success));
+}
+
+}  // namespace
+
+StateFileWriter::StateFileWriter(
+    const base::FilePath& path,
+    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    base::TimeDelta interval)
+    : writer_(path, task_runner, interval),
+      weak_factory_(this) {
+}
+
+StateFileWriter::~StateFileWriter() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  // ImportantFileWriter expects no pending write when it goes away.
+  Flush();
+}
+
+void StateFileWriter::Save(const std::string& data, WriteCallback callback) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  pending_data_ = data;
+  pending_callbacks_.push_back(std::move(callback));
+  writer_.ScheduleWrite(this);
+}
+
+void StateFileWriter::Flush() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (writer_.HasPendingWrite())
+    writer_.DoScheduledWrite();
+}
+
+bool StateFileWriter::SerializeData(std::string* data) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  UMA_HISTOGRAM_COUNTS_1M("Brave.Rewards.StateFileWriteSize",
+                          pending_data_.size());
+  UMA_HISTOGRAM_COUNTS_100("Brave.Rewards.StateFileSavesPerWrite",
+                           pending_callbacks_.size());
+
+  // Hand the callbacks of every save coalesced into this write to its
+  // completion.
+  writer_.RegisterOnNextWriteCallbacks(
+      base::Closure(),
+      base::Bind(&PostWriteDone,
+          base::SequencedTaskRunnerHandle::Get(),
+          base::Bind(&StateFileWriter::OnWriteDone,
+              weak_factory_.GetWeakPtr(),
+              base::Passed(std::move(pending_callbacks_)))));
+  pending_callbacks_.clear();
+
+  data->swap(pending_data_);
+  pending_data_.clear();
+  return true;
+}
+
+void StateFileWriter::OnWriteDone(std::vector<WriteCallback> callbacks,
+                                  bool success) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(success);
+}
+
+}  // namespace brave_rewards
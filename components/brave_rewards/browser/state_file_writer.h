@@ -0,0 +1,61 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_STATE_FILE_WRITER_H_
+#define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_STATE_FILE_WRITER_H_
+
+#include <string>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/files/important_file_writer.h"
+#include "base/macros.h"
+#include "base/memory/weak_ptr.h"
+#include "base/sequence_checker.h"
+
+namespace base {
+class FilePath;
+class SequencedTaskRunner;
+}  // namespace base
+
+namespace brave_rewards {
+
+// Keeps one ImportantFileWriter per state file and coalesces saves: only the
+// latest data is written, at most once per |interval|. Every callback passed
+// to Save() runs on the calling sequence once the write that includes its
+// data has finished. Destroying the writer still writes pending data, but
+// its callbacks are dropped.
+class StateFileWriter : public base::ImportantFileWriter::DataSerializer {
+ public:
+  using WriteCallback = base::OnceCallback<void(bool success)>;
+
+  StateFileWriter(const base::FilePath& path,
+                  scoped_refptr<base::SequencedTaskRunner> task_runner,
+                  base::TimeDelta interval);
+  ~StateFileWriter() override;
+
+  void Save(const std::string& data, WriteCallback callback);
+
+  // Writes pending data right away, e.g. before the file is read back.
+  void Flush();
+
+ private:
+  // base::ImportantFileWriter::DataSerializer:
+  bool SerializeData(std::string* data) override;
+
+  void OnWriteDone(std::vector<WriteCallback> callbacks, bool success);
+
+  base::ImportantFileWriter writer_;
+  std::string pending_data_;
+  std::vector<WriteCallback> pending_callbacks_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+  base::WeakPtrFactory<StateFileWriter> weak_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(StateFileWriter);
+};
+
+}  // namespace brave_rewards
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_STATE_FILE_WRITER_H_
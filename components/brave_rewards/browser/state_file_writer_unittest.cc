@@ -0,0 +1,98 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/state_file_writer.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/scoped_task_environment.h"
+#include "base/threading/thread_task_runner_handle.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+using brave_rewards::StateFileWriter;
+
+constexpr base::TimeDelta kInterval = base::TimeDelta::FromSeconds(2);
+
+class StateFileWriterTest : public testing::Test {
+ public:
+  StateFileWriterTest()
+      : scoped_task_environment_(
+            base::test::ScopedTaskEnvironment::MainThreadType::MOCK_TIME) {}
+
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.GetPath().AppendASCII("state");
+    writer_.reset(new StateFileWriter(
+        path_, base::ThreadTaskRunnerHandle::Get(), kInterval));
+  }
+
+ protected:
+  StateFileWriter::WriteCallback WriteCallback(int id) {
+    return base::BindOnce(&StateFileWriterTest::OnWriteDone,
+                          base::Unretained(this), id);
+  }
+
+  void OnWriteDone(int id, bool success) {
+    EXPECT_TRUE(success);
+    written_.push_back(id);
+  }
+
+  std::string ReadFile() {
+    std::string data;
+    base::ReadFileToString(path_, &data);
+    return data;
+  }
+
+  base::test::ScopedTaskEnvironment scoped_task_environment_;
+  base::ScopedTempDir temp_dir_;
+  base::FilePath path_;
+  std::unique_ptr<StateFileWriter> writer_;
+  std::vector<int> written_;
+};
+
+TEST_F(StateFileWriterTest, CoalescesSaves) {
+  writer_->Save("first", WriteCallback(1));
+  writer_->Save("second", WriteCallback(2));
+  writer_->Save("third", WriteCallback(3));
+  scoped_task_environment_.RunUntilIdle();
+  EXPECT_FALSE(base::PathExists(path_));
+  EXPECT_TRUE(written_.empty());
+
+  // One write with the latest data answers every save.
+  scoped_task_environment_.FastForwardBy(kInterval);
+  EXPECT_EQ("third", ReadFile());
+  EXPECT_EQ(std::vector<int>({1, 2, 3}), written_);
+
+  // A later save starts a new write.
+  writer_->Save("fourth", WriteCallback(4));
+  scoped_task_environment_.FastForwardBy(kInterval);
+  EXPECT_EQ("fourth", ReadFile());
+  EXPECT_EQ(std::vector<int>({1, 2, 3, 4}), written_);
+}
+
+TEST_F(StateFileWriterTest, FlushWritesRightAway) {
+  writer_->Save("data", WriteCallback(1));
+  writer_->Flush();
+  scoped_task_environment_.RunUntilIdle();
+  EXPECT_EQ("data", ReadFile());
+  EXPECT_EQ(std::vector<int>({1}), written_);
+}
+
+TEST_F(StateFileWriterTest, DestroyingWritesButDropsCallbacks) {
+  writer_->Save("data", WriteCallback(1));
+  writer_.reset();
+  scoped_task_environment_.RunUntilIdle();
+  EXPECT_EQ("data", ReadFile());
+  EXPECT_TRUE(written_.empty());
+}
+
+}  // namespace
@@ -84,8 +84,13 @@ export const onQRGenerated = (type: Rewards.AddressesType, image: string) => act
   image
 })
 
-export const onContributeList = (list: Rewards.Publisher[]) => action(types.ON_CONTRIBUTE_LIST, {
-  list
+export const onContributeList = (list: Rewards.Publisher[], version: number) => action(types.ON_CONTRIBUTE_LIST, {
+  list,
+  version
+})
+
+export const onContributeListPatch = (patch: Rewards.PublisherListPatch) => action(types.ON_CONTRIBUTE_LIST_PATCH, {
+  patch
 })
 
 export const onBalanceReports = (reports: Record<string, Rewards.Report>) => action(types.ON_BALANCE_REPORTS, {
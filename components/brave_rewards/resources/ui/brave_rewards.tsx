@@ -89,8 +89,12 @@ window.cr.define('brave_rewards', function () {
     getActions().onAddresses(addresses)
   }
 
-  function contributeList (list: Rewards.Publisher[]) {
-    getActions().onContributeList(list)
+  function contributeList (list: Rewards.Publisher[], version: number) {
+    getActions().onContributeList(list, version)
+  }
+
+  function contributeListPatch (patch: Rewards.PublisherListPatch) {
+    getActions().onContributeListPatch(patch)
   }
 
   function numExcludedSites (num: string) {
@@ -130,6 +134,7 @@ window.cr.define('brave_rewards', function () {
     reconcileStamp,
     addresses,
     contributeList,
+    contributeListPatch,
     numExcludedSites,
     balanceReports,
     walletExists,
@@ -29,6 +29,7 @@ export const enum types {
   ON_ADDRESSES = '@@rewards/ON_ADDRESSES',
   ON_QR_GENERATED = '@@rewards/ON_QR_GENERATED',
   ON_CONTRIBUTE_LIST = '@@rewards/ON_CONTRIBUTE_LIST',
+  ON_CONTRIBUTE_LIST_PATCH = '@@rewards/ON_CONTRIBUTE_LIST_PATCH',
   ON_BALANCE_REPORTS = '@@rewards/ON_BALANCE_REPORTS',
   ON_EXCLUDE_PUBLISHER = '@@rewards/ON_EXCLUDE_PUBLISHER',
   ON_RESTORE_PUBLISHERS = '@@rewards/ON_RESTORE_PUBLISHERS',
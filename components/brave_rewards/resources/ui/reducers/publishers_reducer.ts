@@ -17,7 +17,36 @@ const publishersReducer: Reducer<Rewards.State | undefined> = (state: Rewards.St
         state.contributeLoad = true
       }
       state.autoContributeList = action.payload.list
+      state.autoContributeListVersion = action.payload.version
       break
+    case types.ON_CONTRIBUTE_LIST_PATCH:
+      {
+        const patch: Rewards.PublisherListPatch = action.payload.patch
+        if (patch.baseVersion !== state.autoContributeListVersion) {
+          // Missed an update, start over from the full list
+          chrome.send('brave_rewards.getContributionList')
+          break
+        }
+
+        const updated: Record<string, Rewards.Publisher> = {}
+        patch.updated.forEach((publisher: Rewards.Publisher) => {
+          updated[publisher.id] = publisher
+        })
+
+        const list = state.autoContributeList
+          .filter((publisher: Rewards.Publisher) =>
+            !patch.removed.includes(publisher.id) && !updated[publisher.id])
+          .concat(patch.updated)
+          .sort((a: Rewards.Publisher, b: Rewards.Publisher) =>
+            b.percentage - a.percentage)
+
+        state = {
+          ...state,
+          autoContributeList: list,
+          autoContributeListVersion: patch.version
+        }
+        break
+      }
     case types.ON_NUM_EXCLUDED_SITES:
       state = { ...state }
       if (action.payload.num != null) {
@@ -39,6 +39,7 @@ export const defaultState: Rewards.State = {
     walletCorrupted: false
   },
   autoContributeList: [],
+  autoContributeListVersion: 0,
   reports: {},
   recurringList: [],
   tipsList: [],
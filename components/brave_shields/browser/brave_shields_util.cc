@@ -13,7 +13,6 @@
 #include "components/content_settings/core/browser/host_content_settings_map.h"
 #include "components/content_settings/core/common/content_settings_types.h"
 #include "components/content_settings/core/common/content_settings_utils.h"
-#include "content/public/common/referrer.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/resource_request_info.h"
 #include "content/public/browser/websocket_handshake_request_info.h"
@@ -23,7 +22,6 @@
 
 using content::ResourceContext;
 using content::BrowserThread;
-using content::Referrer;
 using content::ResourceRequestInfo;
 using net::URLRequest;
 using namespace net::registry_controlled_domains;
@@ -129,24 +127,17 @@ void DispatchBlockedEventFromIO(const GURL &request_url, int render_frame_id,
           render_process_id, render_frame_id, frame_tree_node_id));
 }
 
-bool ShouldSetReferrer(bool allow_referrers, bool shields_up,
+bool ShouldBlockReferrer(bool allow_referrers, bool shields_up,
     const GURL& original_referrer, const GURL& tab_origin,
-    const GURL& target_url, const GURL& new_referrer_url,
-    blink::WebReferrerPolicy policy, Referrer *output_referrer) {
-  if (!output_referrer ||
-      allow_referrers ||
-      !shields_up ||
-      original_referrer.is_empty() ||
+    const GURL& target_url) {
+  return !allow_referrers &&
+      shields_up &&
+      !original_referrer.is_empty() &&
       // Same TLD+1 whouldn't set the referrer
-      SameDomainOrHost(target_url, original_referrer,
-          INCLUDE_PRIVATE_REGISTRIES) ||
+      !SameDomainOrHost(target_url, original_referrer,
+          INCLUDE_PRIVATE_REGISTRIES) &&
       // Whitelisted referrers shoud never set the referrer
-      brave::IsWhitelistedReferrer(tab_origin, target_url.GetOrigin())) {
-    return false;
-  }
-  *output_referrer = Referrer::SanitizeForRequest(target_url,
-      Referrer(new_referrer_url, policy));
-  return true;
+      !brave::IsWhitelistedReferrer(tab_origin, target_url.GetOrigin());
 }
 
 }  // namespace brave_shields
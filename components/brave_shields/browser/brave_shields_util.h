@@ -9,16 +9,11 @@
 #include <string>
 
 #include "components/content_settings/core/common/content_settings_types.h"
-#include "third_party/blink/public/platform/web_referrer_policy.h"
 
 namespace net {
 class URLRequest;
 }
 
-namespace content {
-struct Referrer;
-}
-
 class GURL;
 class ProfileIOData;
 
@@ -43,10 +38,11 @@ void GetRenderFrameInfo(const net::URLRequest* request,
     int* render_process_id,
     int* frame_tree_node_id);
 
-bool ShouldSetReferrer(bool allow_referrers, bool shields_up,
+// Whether shields strip the referrer of a request to |target_url|, made from
+// a tab at |tab_origin| with |original_referrer|.
+bool ShouldBlockReferrer(bool allow_referrers, bool shields_up,
     const GURL& original_referrer, const GURL& tab_origin,
-    const GURL& target_url, const GURL& new_referrer_url,
-    blink::WebReferrerPolicy policy, content::Referrer *output_referrer);
+    const GURL& target_url);
 
 }  // namespace brave_shields
 
@@ -326,7 +326,13 @@ void BraveShieldsWebContentsObserver::ReadyToCommitNavigation(
 
 void BraveShieldsWebContentsObserver::AllowScriptsOnce(
     const std::vector<std::string>& origins, WebContents* contents) {
-  allowed_script_origins_ = std::move(origins);
+  allowed_script_origins_.clear();
+  allowed_script_origins_.reserve(origins.size());
+  for (const auto& origin_spec : origins) {
+    url::Origin origin = url::Origin::Create(GURL(origin_spec));
+    if (!origin.opaque())
+      allowed_script_origins_.push_back(std::move(origin));
+  }
 }
 
 }  // namespace brave_shields
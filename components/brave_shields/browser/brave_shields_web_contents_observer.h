@@ -10,6 +10,7 @@
 #include "base/strings/string16.h"
 #include "content/public/browser/web_contents_observer.h"
 #include "content/public/browser/web_contents_user_data.h"
+#include "url/origin.h"
 
 namespace content {
 class WebContents;
@@ -82,7 +83,9 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
 
  private:
   friend class content::WebContentsUserData<BraveShieldsWebContentsObserver>;
-  std::vector<std::string> allowed_script_origins_;
+  // Parsed once here so renderers can match script origins without building
+  // origin strings per script.
+  std::vector<url::Origin> allowed_script_origins_;
   // We keep a set of the current page's blocked URLs in case the page
   // continually tries to load the same blocked URLs.
   std::set<std::string> blocked_url_paths_;
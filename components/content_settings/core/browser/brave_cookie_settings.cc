@@ -6,6 +6,7 @@
 
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "brave/common/brave_cookie_blocking.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "url/gurl.h"
 
@@ -13,15 +14,96 @@ namespace content_settings {
 
 using namespace net::registry_controlled_domains;
 
+namespace {
+
+// Number of tab origins whose shields cookie settings are remembered.
+const size_t kMaxCachedShieldsCookieSettings = 256;
+
+}  // namespace
+
 BraveCookieSettings::BraveCookieSettings(
     HostContentSettingsMap* host_content_settings_map,
     PrefService* prefs,
     const char* extension_scheme)
-    : CookieSettings(host_content_settings_map, prefs, extension_scheme)
-{ }
+    : CookieSettings(host_content_settings_map, prefs, extension_scheme),
+      shields_cookie_settings_cache_(kMaxCachedShieldsCookieSettings),
+      shields_cookie_settings_generation_(0) {
+  host_content_settings_map_->AddObserver(this);
+}
 
 BraveCookieSettings::~BraveCookieSettings() { }
 
+void BraveCookieSettings::ShutdownOnUIThread() {
+  host_content_settings_map_->RemoveObserver(this);
+  CookieSettings::ShutdownOnUIThread();
+}
+
+void BraveCookieSettings::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsType content_type,
+    const std::string& resource_identifier) {
+  // Shields settings are stored as plugins settings; DEFAULT means that all
+  // types may have changed.
+  if (content_type != CONTENT_SETTINGS_TYPE_PLUGINS &&
+      content_type != CONTENT_SETTINGS_TYPE_DEFAULT)
+    return;
+
+  base::AutoLock lock(shields_cookie_settings_lock_);
+  shields_cookie_settings_cache_.Clear();
+  ++shields_cookie_settings_generation_;
+}
+
+uint64_t BraveCookieSettings::GetShieldsSettingsGeneration() const {
+  base::AutoLock lock(shields_cookie_settings_lock_);
+  return shields_cookie_settings_generation_;
+}
+
+BraveCookieSettings::ShieldsCookieSettings
+BraveCookieSettings::GetShieldsCookieSettings(const GURL& primary_url) const {
+  // Only http(s) URLs are cached by origin. Other schemes can't be keyed on
+  // it, e.g. every file: URL has the origin file:/// while file patterns
+  // match on the path.
+  const bool cacheable = primary_url.SchemeIsHTTPOrHTTPS();
+  const std::string key = cacheable ? primary_url.GetOrigin().spec()
+                                    : std::string();
+  uint64_t generation = 0;
+  if (cacheable) {
+    base::AutoLock lock(shields_cookie_settings_lock_);
+    auto it = shields_cookie_settings_cache_.Get(key);
+    if (it != shields_cookie_settings_cache_.end())
+      return it->second;
+    generation = shields_cookie_settings_generation_;
+  }
+
+  ContentSetting brave_shields_setting =
+      host_content_settings_map_->GetContentSetting(
+          primary_url, GURL(),
+          CONTENT_SETTINGS_TYPE_PLUGINS, brave_shields::kBraveShields);
+  ContentSetting brave_1p_setting = host_content_settings_map_->GetContentSetting(
+      primary_url, GURL("https://firstParty/"),
+      CONTENT_SETTINGS_TYPE_PLUGINS, brave_shields::kCookies);
+  ContentSetting brave_3p_setting =
+      host_content_settings_map_->GetContentSetting(
+          primary_url, GURL(),
+          CONTENT_SETTINGS_TYPE_PLUGINS, brave_shields::kCookies);
+
+  ShieldsCookieSettings settings;
+  settings.allow_brave_shields =
+      brave_shields_setting == CONTENT_SETTING_ALLOW ||
+      brave_shields_setting == CONTENT_SETTING_DEFAULT;
+  settings.allow_1p_cookies = brave_1p_setting == CONTENT_SETTING_ALLOW ||
+    brave_1p_setting == CONTENT_SETTING_DEFAULT;
+  settings.allow_3p_cookies = brave_3p_setting == CONTENT_SETTING_ALLOW;
+
+  if (cacheable) {
+    base::AutoLock lock(shields_cookie_settings_lock_);
+    if (generation == shields_cookie_settings_generation_)
+      shields_cookie_settings_cache_.Put(key, settings);
+  }
+  return settings;
+}
+
 void BraveCookieSettings::GetCookieSetting(const GURL& url,
     const GURL& first_party_url,
     content_settings::SettingSource* source,
@@ -45,26 +127,10 @@ void BraveCookieSettings::GetCookieSetting(const GURL& url,
   GURL primary_url = (tab_url == GURL("about:blank") || tab_url.is_empty() ?
       first_party_url : tab_url);
 
-  ContentSetting brave_shields_setting =
-      host_content_settings_map_->GetContentSetting(
-          primary_url, GURL(),
-          CONTENT_SETTINGS_TYPE_PLUGINS, brave_shields::kBraveShields);
-  ContentSetting brave_1p_setting = host_content_settings_map_->GetContentSetting(
-      primary_url, GURL("https://firstParty/"),
-      CONTENT_SETTINGS_TYPE_PLUGINS, brave_shields::kCookies);
-  ContentSetting brave_3p_setting =
-      host_content_settings_map_->GetContentSetting(
-          primary_url, GURL(),
-          CONTENT_SETTINGS_TYPE_PLUGINS, brave_shields::kCookies);
-
-  bool allow_brave_shields = brave_shields_setting == CONTENT_SETTING_ALLOW ||
-    brave_shields_setting == CONTENT_SETTING_DEFAULT;
-  bool allow_1p_cookies = brave_1p_setting == CONTENT_SETTING_ALLOW ||
-    brave_1p_setting == CONTENT_SETTING_DEFAULT;
-  bool allow_3p_cookies = brave_3p_setting == CONTENT_SETTING_ALLOW;
-
-  if (ShouldBlockCookie(allow_brave_shields, allow_1p_cookies,
-      allow_3p_cookies, first_party_url, url)) {
+  const ShieldsCookieSettings settings = GetShieldsCookieSettings(primary_url);
+  if (ShouldBlockCookie(settings.allow_brave_shields,
+      settings.allow_1p_cookies, settings.allow_3p_cookies,
+      first_party_url, url)) {
     *cookie_setting = CONTENT_SETTING_BLOCK;
   }
 }
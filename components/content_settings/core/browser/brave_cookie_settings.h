@@ -5,15 +5,43 @@
 #ifndef BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_COOKIE_SETTINGS_H_
 #define BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_COOKIE_SETTINGS_H_
 
+#include <string>
+
+#include "base/containers/mru_cache.h"
+#include "base/synchronization/lock.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
 #include "components/content_settings/core/browser/cookie_settings.h"
 
 namespace content_settings {
 
-class BraveCookieSettings : public CookieSettings {
+class BraveCookieSettings : public CookieSettings,
+                            public content_settings::Observer {
  public:
+  // Brave shields settings that decide whether a cookie is blocked.
+  struct ShieldsCookieSettings {
+    bool allow_brave_shields = true;
+    bool allow_1p_cookies = true;
+    bool allow_3p_cookies = false;
+  };
+
   BraveCookieSettings(HostContentSettingsMap* host_content_settings_map,
                       PrefService* prefs,
                       const char* extension_scheme = kDummyExtensionScheme);
+
+  // RefcountedKeyedService:
+  void ShutdownOnUIThread() override;
+
+  // Returns the shields cookie settings of |primary_url|. Results for http(s)
+  // URLs are cached per origin until content settings change, and the cache
+  // is shared by every cookie access path of the profile (cookie settings,
+  // the network delegate and the content browser client). Can be called on
+  // any thread.
+  ShieldsCookieSettings GetShieldsCookieSettings(const GURL& primary_url) const;
+
+  // Changes whenever a shields setting of the profile changes, so callers can
+  // keep their own caches of shields decisions. Can be called on any thread.
+  uint64_t GetShieldsSettingsGeneration() const;
+
   void GetCookieSetting(const GURL& url,
                         const GURL& first_party_url,
                         content_settings::SettingSource* source,
@@ -29,8 +57,26 @@ class BraveCookieSettings : public CookieSettings {
   bool IsCookieAccessAllowed(const GURL& url,
                              const GURL& first_party_url,
                              const GURL& tab_url) const;
+
+  // content_settings::Observer:
+  void OnContentSettingChanged(const ContentSettingsPattern& primary_pattern,
+                               const ContentSettingsPattern& secondary_pattern,
+                               ContentSettingsType content_type,
+                               const std::string& resource_identifier) override;
+
  protected:
   ~BraveCookieSettings() override;
+
+ private:
+  // Guards the cache below, which is read on the IO thread and invalidated on
+  // the UI thread.
+  mutable base::Lock shields_cookie_settings_lock_;
+  mutable base::HashingMRUCache<std::string, ShieldsCookieSettings>
+      shields_cookie_settings_cache_;
+  // Bumped on every invalidation so lookups racing with a content settings
+  // change don't repopulate the cache with stale values.
+  uint64_t shields_cookie_settings_generation_;
+
   DISALLOW_COPY_AND_ASSIGN(BraveCookieSettings);
 };
 
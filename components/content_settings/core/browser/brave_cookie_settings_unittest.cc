@@ -0,0 +1,72 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/content_settings/core/browser/brave_cookie_settings.h"
+
+#include <string>
+
+#include "base/memory/scoped_refptr.h"
+#include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/test/base/testing_profile.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "content/public/test/test_browser_thread_bundle.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+using content_settings::BraveCookieSettings;
+
+class BraveCookieSettingsTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    cookie_settings_ = base::MakeRefCounted<BraveCookieSettings>(
+        map(), profile_.GetPrefs());
+  }
+
+  void TearDown() override {
+    cookie_settings_->ShutdownOnUIThread();
+  }
+
+  HostContentSettingsMap* map() {
+    return HostContentSettingsMapFactory::GetForProfile(&profile_);
+  }
+
+  void SetShieldsSetting(const std::string& pattern, ContentSetting setting) {
+    map()->SetContentSettingCustomScope(
+        ContentSettingsPattern::FromString(pattern),
+        ContentSettingsPattern::Wildcard(),
+        CONTENT_SETTINGS_TYPE_PLUGINS, brave_shields::kBraveShields, setting);
+  }
+
+  bool AllowBraveShields(const GURL& url) {
+    return cookie_settings_->GetShieldsCookieSettings(url).allow_brave_shields;
+  }
+
+  content::TestBrowserThreadBundle thread_bundle_;
+  TestingProfile profile_;
+  scoped_refptr<BraveCookieSettings> cookie_settings_;
+};
+
+TEST_F(BraveCookieSettingsTest, CachedSettingsFollowChanges) {
+  const GURL url("https://brave.com/index.html");
+  EXPECT_TRUE(AllowBraveShields(url));
+
+  SetShieldsSetting("[*.]brave.com", CONTENT_SETTING_BLOCK);
+  EXPECT_FALSE(AllowBraveShields(url));
+  EXPECT_FALSE(AllowBraveShields(GURL("https://brave.com/other.html")));
+
+  SetShieldsSetting("[*.]brave.com", CONTENT_SETTING_ALLOW);
+  EXPECT_TRUE(AllowBraveShields(url));
+}
+
+TEST_F(BraveCookieSettingsTest, FileURLsDoNotShareSettings) {
+  const GURL blocked_url("file:///tmp/blocked.html");
+  const GURL other_url("file:///tmp/other.html");
+  SetShieldsSetting("file:///tmp/blocked.html", CONTENT_SETTING_BLOCK);
+
+  // Both have the origin file:///, but the pattern only matches one.
+  EXPECT_FALSE(AllowBraveShields(blocked_url));
+  EXPECT_TRUE(AllowBraveShields(other_url));
+  EXPECT_FALSE(AllowBraveShields(blocked_url));
+}
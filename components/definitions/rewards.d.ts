@@ -26,6 +26,7 @@ declare namespace Rewards {
   export interface State {
     addresses?: Record<AddressesType, Address>
     autoContributeList: Publisher[]
+    autoContributeListVersion: number
     connectedWallet: boolean
     contributeLoad: boolean
     contributionMinTime: number
@@ -117,6 +118,13 @@ declare namespace Rewards {
     tipDate?: number
   }
 
+  export interface PublisherListPatch {
+    baseVersion: number
+    version: number
+    updated: Publisher[]
+    removed: string[]
+  }
+
   export interface Report {
     ads: string
     closing: string
@@ -40,4 +40,20 @@ describe('rewards_actions', () => {
       }
     })
   })
+
+  it('onContributeListPatch', () => {
+    const patch: Rewards.PublisherListPatch = {
+      baseVersion: 1,
+      version: 2,
+      updated: [],
+      removed: ['brave.com']
+    }
+    expect(actions.onContributeListPatch(patch)).toEqual({
+      type: types.ON_CONTRIBUTE_LIST_PATCH,
+      meta: undefined,
+      payload: {
+        patch
+      }
+    })
+  })
 })
@@ -0,0 +1,93 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+/* global chrome */
+
+import reducers from '../../../../brave_rewards/resources/ui/reducers/index'
+import * as actions from '../../../../brave_rewards/resources/ui/actions/rewards_actions'
+import { defaultState } from '../../../../brave_rewards/resources/ui/storage'
+
+const publisher = (id: string, percentage: number): Rewards.Publisher => ({
+  publisherKey: id,
+  percentage,
+  verified: false,
+  excluded: 0,
+  url: `https://${id}`,
+  name: id,
+  provider: '',
+  favIcon: '',
+  id
+})
+
+describe('publishers reducer', () => {
+  const state = {
+    rewardsData: {
+      ...defaultState,
+      autoContributeList: [
+        publisher('a.com', 50),
+        publisher('b.com', 30),
+        publisher('c.com', 20)
+      ],
+      autoContributeListVersion: 3
+    }
+  }
+
+  describe('ON_CONTRIBUTE_LIST_PATCH', () => {
+    let sendSpy: jest.SpyInstance
+
+    beforeEach(() => {
+      sendSpy = jest.spyOn(chrome, 'send')
+    })
+
+    afterEach(() => {
+      sendSpy.mockRestore()
+    })
+
+    it('replaces updated publishers and re-sorts the list', () => {
+      const assertion = reducers(state, actions.onContributeListPatch({
+        baseVersion: 3,
+        version: 4,
+        updated: [publisher('c.com', 60), publisher('d.com', 10)],
+        removed: []
+      }))
+
+      expect(assertion.rewardsData.autoContributeList).toEqual([
+        publisher('c.com', 60),
+        publisher('a.com', 50),
+        publisher('b.com', 30),
+        publisher('d.com', 10)
+      ])
+      expect(assertion.rewardsData.autoContributeListVersion).toBe(4)
+      expect(sendSpy).not.toHaveBeenCalled()
+    })
+
+    it('drops removed publishers', () => {
+      const assertion = reducers(state, actions.onContributeListPatch({
+        baseVersion: 3,
+        version: 4,
+        updated: [publisher('a.com', 70)],
+        removed: ['b.com']
+      }))
+
+      expect(assertion.rewardsData.autoContributeList).toEqual([
+        publisher('a.com', 70),
+        publisher('c.com', 20)
+      ])
+      expect(assertion.rewardsData.autoContributeListVersion).toBe(4)
+    })
+
+    it('refetches the full list when a patch was missed', () => {
+      const assertion = reducers(state, actions.onContributeListPatch({
+        baseVersion: 4,
+        version: 5,
+        updated: [publisher('d.com', 10)],
+        removed: ['a.com']
+      }))
+
+      expect(sendSpy).toHaveBeenCalledWith('brave_rewards.getContributionList')
+      expect(assertion.rewardsData.autoContributeList)
+        .toEqual(state.rewardsData.autoContributeList)
+      expect(assertion.rewardsData.autoContributeListVersion).toBe(3)
+    })
+  })
+})
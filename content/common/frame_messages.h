@@ -6,6 +6,8 @@
 #include <vector>
 
 #include "ipc/ipc_message_macros.h"
+#include "url/ipc/url_param_traits.h"
+#include "url/origin.h"
 
 // The message starter should be declared in ipc/ipc_message_start.h. Since
 // we don't want to patch Chromium, we just pretend to be Content Shell.
@@ -14,4 +16,4 @@
 
 // Tell RenderFrame(s) to temporary allow scripts from a list of origins once.
 IPC_MESSAGE_ROUTED1(BraveFrameMsg_AllowScriptsOnce,
-                    std::vector<std::string> /* origins to allow scripts once */)
+                    std::vector<url::Origin> /* origins to allow scripts once */)
@@ -4,11 +4,12 @@
 
 #include "brave/renderer/brave_content_settings_observer.h"
 
+#include "base/no_destructor.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/common/render_messages.h"
+#include "brave/common/shield_exceptions.h"
 #include "brave/content/common/frame_messages.h"
 #include "components/content_settings/core/common/content_settings_pattern.h"
-#include "components/content_settings/core/common/content_settings_utils.h"
 #include "content/public/renderer/render_frame.h"
 #include "services/service_manager/public/cpp/interface_provider.h"
 #include "third_party/blink/public/platform/web_url.h"
@@ -17,11 +18,22 @@
 #include "third_party/blink/public/web/web_local_frame.h"
 #include "url/url_constants.h"
 
+namespace {
+
+const ContentSettingsPattern& FirstPartyPattern() {
+  static const base::NoDestructor<ContentSettingsPattern> pattern(
+      ContentSettingsPattern::FromString("https://firstParty/*"));
+  return *pattern;
+}
+
+}  // namespace
+
 BraveContentSettingsObserver::BraveContentSettingsObserver(
     content::RenderFrame* render_frame,
     bool should_whitelist,
     service_manager::BinderRegistry* registry)
-    : ContentSettingsObserver(render_frame, should_whitelist, registry) {
+    : ContentSettingsObserver(render_frame, should_whitelist, registry),
+      indexed_rules_generation_(0) {
 }
 
 BraveContentSettingsObserver::~BraveContentSettingsObserver() {
@@ -39,8 +51,9 @@ bool BraveContentSettingsObserver::OnMessageReceived(const IPC::Message& message
 }
 
 void BraveContentSettingsObserver::OnAllowScriptsOnce(
-    const std::vector<std::string>& origins) {
-  preloaded_temporarily_allowed_scripts_ = std::move(origins);
+    const std::vector<url::Origin>& origins) {
+  preloaded_temporarily_allowed_scripts_ =
+      base::flat_set<url::Origin>(origins.begin(), origins.end());
 }
 
 void BraveContentSettingsObserver::DidCommitProvisionalLoad(
@@ -48,6 +61,7 @@ void BraveContentSettingsObserver::DidCommitProvisionalLoad(
   if (!is_same_document_navigation) {
     temporarily_allowed_scripts_ =
       std::move(preloaded_temporarily_allowed_scripts_);
+    script_origin_decisions_.clear();
   }
 
   ContentSettingsObserver::DidCommitProvisionalLoad(
@@ -55,10 +69,9 @@ void BraveContentSettingsObserver::DidCommitProvisionalLoad(
 }
 
 bool BraveContentSettingsObserver::IsScriptTemporilyAllowed(
-    const GURL& script_url) {
+    const url::Origin& script_origin) {
   // check if scripts from this origin are temporily allowed or not
-  return base::ContainsKey(temporarily_allowed_scripts_,
-      script_url.GetOrigin().spec());
+  return base::ContainsKey(temporarily_allowed_scripts_, script_origin);
 }
 
 void BraveContentSettingsObserver::BraveSpecificDidBlockJavaScript(
@@ -73,13 +86,13 @@ bool BraveContentSettingsObserver::AllowScript(
   blocked_script_url_ = GURL::EmptyGURL();
 
   blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
-  const GURL secondary_url(
-      url::Origin(frame->GetDocument().GetSecurityOrigin()).GetURL());
+  const url::Origin origin(frame->GetDocument().GetSecurityOrigin());
+  const GURL secondary_url(origin.GetURL());
 
   bool allow = ContentSettingsObserver::AllowScript(enabled_per_settings);
   allow = allow ||
     IsBraveShieldsDown(frame, secondary_url) ||
-    IsScriptTemporilyAllowed(secondary_url);
+    IsScriptTemporilyAllowed(origin);
 
   return allow;
 }
@@ -101,16 +114,7 @@ bool BraveContentSettingsObserver::AllowScriptFromSource(
   bool allow = ContentSettingsObserver::AllowScriptFromSource(
       enabled_per_settings, script_url);
 
-  // scripts with whitelisted protocols, such as chrome://extensions should
-  // be allowed
-  bool should_white_list = IsWhitelistedForContentSettings(
-      blink::WebSecurityOrigin::Create(script_url),
-      render_frame()->GetWebFrame()->GetDocument().Url());
-
-  allow = allow ||
-    should_white_list ||
-    IsBraveShieldsDown(render_frame()->GetWebFrame(), secondary_url) ||
-    IsScriptTemporilyAllowed(secondary_url);
+  allow = allow || IsScriptAllowedByBrave(secondary_url);
 
   if (!allow) {
     blocked_script_url_ = secondary_url;
@@ -119,6 +123,34 @@ bool BraveContentSettingsObserver::AllowScriptFromSource(
   return allow;
 }
 
+bool BraveContentSettingsObserver::IsScriptAllowedByBrave(
+    const GURL& script_url) {
+  // drops cached decisions if the rules changed since they were made
+  EnsureRulesIndexed();
+
+  // opaque origins never compare equal, so there is nothing to reuse
+  const url::Origin origin = url::Origin::Create(script_url);
+  if (!origin.opaque()) {
+    auto it = script_origin_decisions_.find(origin);
+    if (it != script_origin_decisions_.end())
+      return it->second;
+  }
+
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+
+  // scripts with whitelisted protocols, such as chrome://extensions should
+  // be allowed
+  bool allow = IsWhitelistedForContentSettings(
+                   blink::WebSecurityOrigin::Create(script_url),
+                   frame->GetDocument().Url()) ||
+               IsBraveShieldsDown(frame, script_url) ||
+               IsScriptTemporilyAllowed(origin);
+
+  if (!origin.opaque())
+    script_origin_decisions_[origin] = allow;
+  return allow;
+}
+
 void BraveContentSettingsObserver::DidBlockFingerprinting(
     const base::string16& details) {
   Send(new BraveViewHostMsg_FingerprintingBlocked(routing_id(), details));
@@ -136,31 +168,43 @@ GURL BraveContentSettingsObserver::GetOriginOrURL(const blink::WebFrame* frame)
   return top_origin.GetURL();
 }
 
+void BraveContentSettingsObserver::EnsureRulesIndexed() {
+  // Generation 0 is the empty set of rules the renderer starts out with.
+  const uint64_t generation =
+      content_setting_rules_ ? content_setting_rules_->generation : 0;
+  if (generation == indexed_rules_generation_)
+    return;
+
+  indexed_rules_generation_ = generation;
+  script_origin_decisions_.clear();
+  brave_shields_rules_index_.Build(content_setting_rules_->brave_shields_rules);
+  fingerprinting_rules_index_.Build(
+      content_setting_rules_->fingerprinting_rules);
+  autoplay_rules_index_.Build(content_setting_rules_->autoplay_rules);
+}
+
 ContentSetting BraveContentSettingsObserver::GetFPContentSettingFromRules(
-    const ContentSettingsForOneType& rules,
+    const brave::ContentSettingRulesIndex& rules,
     const blink::WebFrame* frame,
     const GURL& secondary_url) {
-
-  if (rules.size() == 0)
-    return CONTENT_SETTING_DEFAULT;
-
   const GURL& primary_url = GetOriginOrURL(frame);
-
-  for (const auto& rule : rules) {
-    ContentSettingsPattern secondary_pattern = rule.secondary_pattern;
-    if (rule.secondary_pattern ==
-        ContentSettingsPattern::FromString("https://firstParty/*")) {
-      secondary_pattern = ContentSettingsPattern::FromString(
-          "[*.]" + GetOriginOrURL(frame).HostNoBrackets());
-    }
-
-    if (rule.primary_pattern.Matches(primary_url) &&
-        (secondary_pattern == ContentSettingsPattern::Wildcard() ||
-         secondary_pattern.Matches(secondary_url))) {
-      return rule.GetContentSetting();
+  const ContentSettingsPattern first_party_pattern =
+      ContentSettingsPattern::FromString("[*.]" + primary_url.HostNoBrackets());
+
+  for (const auto* rule : rules.GetMatchingRules(primary_url)) {
+    const ContentSettingsPattern& secondary_pattern =
+        rule->secondary_pattern == FirstPartyPattern() ?
+            first_party_pattern : rule->secondary_pattern;
+    if (secondary_pattern == ContentSettingsPattern::Wildcard() ||
+        secondary_pattern.Matches(secondary_url)) {
+      return rule->GetContentSetting();
     }
   }
 
+  // default rule: first party resources are allowed
+  if (first_party_pattern.Matches(secondary_url))
+    return CONTENT_SETTING_ALLOW;
+
   // for cases which are third party resources and doesn't match any existing
   // rules, block them by default
   return CONTENT_SETTING_BLOCK;
@@ -170,15 +214,16 @@ bool BraveContentSettingsObserver::IsBraveShieldsDown(
     const blink::WebFrame* frame,
     const GURL& secondary_url) {
   ContentSetting setting = CONTENT_SETTING_DEFAULT;
-  const GURL& primary_url = GetOriginOrURL(frame);
+  EnsureRulesIndexed();
+  if (brave_shields_rules_index_.empty())
+    return false;
 
-  if (content_setting_rules_) {
-    for (const auto& rule : content_setting_rules_->brave_shields_rules) {
-      if (rule.primary_pattern.Matches(primary_url) &&
-          rule.secondary_pattern.Matches(secondary_url)) {
-        setting = rule.GetContentSetting();
-        break;
-      }
+  const GURL& primary_url = GetOriginOrURL(frame);
+  for (const auto* rule :
+       brave_shields_rules_index_.GetMatchingRules(primary_url)) {
+    if (rule->secondary_pattern.Matches(secondary_url)) {
+      setting = rule->GetContentSetting();
+      break;
     }
   }
 
@@ -195,19 +240,9 @@ bool BraveContentSettingsObserver::AllowFingerprinting(
   if (IsBraveShieldsDown(frame, secondary_url)) {
     return true;
   }
-  ContentSettingsForOneType rules;
-  if (content_setting_rules_) {
-      rules = content_setting_rules_->fingerprinting_rules;
-  }
-  ContentSettingPatternSource default_rule =
-      ContentSettingPatternSource(ContentSettingsPattern::Wildcard(),
-                                  ContentSettingsPattern::FromString("https://firstParty/*"),
-                                  base::Value::FromUniquePtrValue(content_settings::ContentSettingToValue(CONTENT_SETTING_ALLOW)),
-                                  std::string(),
-                                  false);
-  rules.push_back(default_rule);
-  ContentSetting setting = GetFPContentSettingFromRules(rules, frame, secondary_url);
-  rules.pop_back();
+  EnsureRulesIndexed();
+  ContentSetting setting = GetFPContentSettingFromRules(
+      fingerprinting_rules_index_, frame, secondary_url);
   bool allow = setting != CONTENT_SETTING_BLOCK;
   allow = allow || IsWhitelistedForContentSettings();
 
@@ -232,47 +267,20 @@ bool BraveContentSettingsObserver::AllowAutoplay(bool default_value) {
   // respect user's site blocklist, if any
   const GURL& primary_url = GetOriginOrURL(frame);
   const GURL& secondary_url = url::Origin(frame->GetDocument().GetSecurityOrigin()).GetURL();
-  for (const auto& rule : content_setting_rules_->autoplay_rules) {
-    if (rule.primary_pattern == ContentSettingsPattern::Wildcard())
+  EnsureRulesIndexed();
+  for (const auto* rule : autoplay_rules_index_.GetMatchingRules(primary_url)) {
+    if (rule->primary_pattern == ContentSettingsPattern::Wildcard())
         continue;
-    if (rule.primary_pattern.Matches(primary_url) &&
-        (rule.secondary_pattern == ContentSettingsPattern::Wildcard() ||
-         rule.secondary_pattern.Matches(secondary_url))) {
-      if (rule.GetContentSetting() == CONTENT_SETTING_BLOCK)
+    if (rule->secondary_pattern == ContentSettingsPattern::Wildcard() ||
+        rule->secondary_pattern.Matches(secondary_url)) {
+      if (rule->GetContentSetting() == CONTENT_SETTING_BLOCK)
         return false;
     }
   }
 
   // in the absence of an explicit block rule, whitelist the following sites
-  std::string kWhitelistPatterns[] = {
-      "[*.]example.com",
-      "[*.]youtube.com",
-      "[*.]khanacademy.org",
-      "[*.]twitch.tv",
-      "[*.]vimeo.com",
-      "[*.]udemy.com",
-      "[*.]duolingo.com",
-      "[*.]giphy.com",
-      "[*.]imgur.com",
-      "[*.]netflix.com",
-      "[*.]hulu.com",
-      "[*.]primevideo.com",
-      "[*.]dailymotion.com",
-      "[*.]tv.com",
-      "[*.]viewster.com",
-      "[*.]metacafe.com",
-      "[*.]d.tube",
-      "[*.]spotify.com",
-      "[*.]lynda.com",
-      "[*.]soundcloud.com",
-      "[*.]pandora.com",
-      "[*.]periscope.tv",
-      "[*.]pscp.tv",
-  };
-  for (const auto& pattern : kWhitelistPatterns) {
-    if (ContentSettingsPattern::FromString(pattern).Matches(primary_url))
-      return true;
-  }
+  if (brave::IsAutoplayWhitelisted(primary_url))
+    return true;
 
   blink::mojom::blink::PermissionServicePtr permission_service;
 
@@ -5,10 +5,13 @@
 #ifndef BRAVE_RENDERER_CONTENT_SETTINGS_OBSERVER_H_
 #define BRAVE_RENDERER_CONTENT_SETTINGS_OBSERVER_H_
 
+#include "base/containers/flat_map.h"
 #include "base/strings/string16.h"
+#include "brave/renderer/content_setting_rules_index.h"
 #include "chrome/renderer/content_settings_observer.h"
 #include "components/content_settings/core/common/content_settings.h"
 #include "components/content_settings/core/common/content_settings_types.h"
+#include "url/origin.h"
 
 namespace blink {
 class WebLocalFrame;
@@ -43,31 +46,52 @@ class BraveContentSettingsObserver
   GURL GetOriginOrURL(const blink::WebFrame* frame);
 
   ContentSetting GetFPContentSettingFromRules(
-      const ContentSettingsForOneType& rules,
+      const brave::ContentSettingRulesIndex& rules,
       const blink::WebFrame* frame,
       const GURL& secondary_url);
 
+  // Rebuilds the per-type rule indexes if |content_setting_rules_| were
+  // replaced since they were last built.
+  void EnsureRulesIndexed();
+
   bool IsBraveShieldsDown(
       const blink::WebFrame* frame,
       const GURL& secondary_url);
 
   // RenderFrameObserver
   bool OnMessageReceived(const IPC::Message& message) override;
-  void OnAllowScriptsOnce(const std::vector<std::string>& origins);
+  void OnAllowScriptsOnce(const std::vector<url::Origin>& origins);
   void DidCommitProvisionalLoad(bool is_same_document_navigation,
                                 ui::PageTransition transition) override;
 
-  bool IsScriptTemporilyAllowed(const GURL& script_url);
+  bool IsScriptTemporilyAllowed(const url::Origin& script_origin);
+
+  // Brave specific part of `AllowScriptFromSource()`, memoized per script
+  // origin for the current document.
+  bool IsScriptAllowedByBrave(const GURL& script_url);
 
   // Origins of scripts which are temporary allowed for this frame in the
   // current load
-  base::flat_set<std::string> temporarily_allowed_scripts_;
+  base::flat_set<url::Origin> temporarily_allowed_scripts_;
 
   // cache blocked script url which will later be used in `DidNotAllowScript()`
   GURL blocked_script_url_;
 
   // temporary allowed script origins we preloaded for the next load
-  base::flat_set<std::string> preloaded_temporarily_allowed_scripts_;
+  base::flat_set<url::Origin> preloaded_temporarily_allowed_scripts_;
+
+  // The renderer-wide rules are reassigned in place without notifying frames,
+  // so every lookup first compares their generation with the one the indexes
+  // were built from.
+  brave::ContentSettingRulesIndex brave_shields_rules_index_;
+  brave::ContentSettingRulesIndex fingerprinting_rules_index_;
+  brave::ContentSettingRulesIndex autoplay_rules_index_;
+  uint64_t indexed_rules_generation_;
+
+  // Decisions of `IsScriptAllowedByBrave()` keyed by script origin. Cleared
+  // on every committed document and by `EnsureRulesIndexed()` whenever the
+  // rules were replaced since the decisions were made.
+  base::flat_map<url::Origin, bool> script_origin_decisions_;
 
   DISALLOW_COPY_AND_ASSIGN(BraveContentSettingsObserver);
 };
@@ -0,0 +1,137 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/renderer/content_setting_rules_index.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "components/content_settings/core/common/content_settings_pattern.h"
+#include "url/gurl.h"
+#include "url/url_constants.h"
+
+namespace brave {
+
+namespace {
+
+const char kDomainWildcard[] = "[*.]";
+
+}  // namespace
+
+ContentSettingRulesIndex::ContentSettingRulesIndex() : rules_(nullptr) {
+}
+
+ContentSettingRulesIndex::~ContentSettingRulesIndex() {
+}
+
+// static
+bool ContentSettingRulesIndex::GetPatternHost(
+    const ContentSettingsPattern& pattern,
+    std::string* host,
+    bool* is_domain_wildcard) {
+  if (!pattern.IsValid() || pattern == ContentSettingsPattern::Wildcard())
+    return false;
+
+  std::string spec = pattern.ToString();
+  size_t host_start = 0;
+  const size_t scheme_end = spec.find(url::kStandardSchemeSeparator);
+  if (scheme_end != std::string::npos) {
+    // file:// patterns are matched on path only.
+    if (spec.compare(0, scheme_end, url::kFileScheme) == 0)
+      return false;
+    host_start = scheme_end + strlen(url::kStandardSchemeSeparator);
+  }
+
+  *is_domain_wildcard = false;
+  if (spec.compare(host_start, strlen(kDomainWildcard),
+                   kDomainWildcard) == 0) {
+    *is_domain_wildcard = true;
+    host_start += strlen(kDomainWildcard);
+  }
+
+  size_t host_end;
+  if (host_start < spec.size() && spec[host_start] == '[') {
+    // IPv6 literal, keep the brackets as GURL::host() does.
+    host_end = spec.find(']', host_start);
+    if (host_end != std::string::npos)
+      ++host_end;
+  } else {
+    host_end = spec.find_first_of(":/", host_start);
+  }
+  if (host_end == std::string::npos)
+    host_end = spec.size();
+
+  *host = spec.substr(host_start, host_end - host_start);
+  return !host->empty() && *host != "*";
+}
+
+void ContentSettingRulesIndex::Build(const ContentSettingsForOneType& rules) {
+  Clear();
+  rules_ = &rules;
+
+  std::string host;
+  bool is_domain_wildcard = false;
+  for (size_t i = 0; i < rules.size(); ++i) {
+    const ContentSettingsPattern& primary = rules[i].primary_pattern;
+    if (!GetPatternHost(primary, &host, &is_domain_wildcard)) {
+      generic_.push_back(i);
+      continue;
+    }
+    if (is_domain_wildcard)
+      domain_wildcards_[host].push_back(i);
+    else
+      exact_hosts_[host].push_back(i);
+  }
+}
+
+void ContentSettingRulesIndex::Clear() {
+  rules_ = nullptr;
+  exact_hosts_.clear();
+  domain_wildcards_.clear();
+  generic_.clear();
+}
+
+void ContentSettingRulesIndex::AppendCandidates(
+    const std::unordered_map<std::string, Bucket>& map,
+    const std::string& host,
+    std::vector<size_t>* candidates) const {
+  auto it = map.find(host);
+  if (it != map.end())
+    candidates->insert(candidates->end(), it->second.begin(), it->second.end());
+}
+
+std::vector<const ContentSettingPatternSource*>
+ContentSettingRulesIndex::GetMatchingRules(const GURL& primary_url) const {
+  std::vector<const ContentSettingPatternSource*> matches;
+  if (empty())
+    return matches;
+
+  std::vector<size_t> candidates(generic_);
+  const std::string& host = primary_url.host();
+  if (!host.empty()) {
+    AppendCandidates(exact_hosts_, host, &candidates);
+    // "[*.]example.com" matches example.com and every subdomain of it, so
+    // probe the host itself and each of its parent domains.
+    size_t pos = 0;
+    while (true) {
+      AppendCandidates(domain_wildcards_, host.substr(pos), &candidates);
+      pos = host.find('.', pos);
+      if (pos == std::string::npos)
+        break;
+      ++pos;
+    }
+  }
+
+  // Each rule lives in exactly one bucket, so restoring the original order is
+  // enough to preserve first-match-wins precedence.
+  std::sort(candidates.begin(), candidates.end());
+  for (size_t index : candidates) {
+    const ContentSettingPatternSource& rule = (*rules_)[index];
+    if (rule.primary_pattern.Matches(primary_url))
+      matches.push_back(&rule);
+  }
+  return matches;
+}
+
+}  // namespace brave
@@ -0,0 +1,69 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_RENDERER_CONTENT_SETTING_RULES_INDEX_H_
+#define BRAVE_RENDERER_CONTENT_SETTING_RULES_INDEX_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "components/content_settings/core/common/content_settings.h"
+
+class GURL;
+
+namespace brave {
+
+// Buckets the rules of one content settings type by the host of their primary
+// pattern, so a lookup only runs ContentSettingsPattern::Matches() against
+// rules that can possibly apply to the primary URL instead of all of them.
+// Rules without a concrete host (e.g. "*" or file:// patterns) are kept in a
+// generic bucket that is always consulted.
+//
+// The index refers to the rules it was built from, which must stay unchanged
+// until the next Build() or Clear(). The renderer-wide
+// RendererContentSettingRules are reassigned in place whenever the browser
+// pushes new settings, so owners compare RendererContentSettingRules'
+// generation before using the index.
+class ContentSettingRulesIndex {
+ public:
+  ContentSettingRulesIndex();
+  ~ContentSettingRulesIndex();
+
+  void Build(const ContentSettingsForOneType& rules);
+  void Clear();
+
+  bool empty() const { return !rules_ || rules_->empty(); }
+
+  // Returns the rules whose primary pattern matches |primary_url|, in the
+  // same precedence order as the indexed ContentSettingsForOneType. The
+  // pointers point into the indexed rules.
+  std::vector<const ContentSettingPatternSource*> GetMatchingRules(
+      const GURL& primary_url) const;
+
+  // Extracts the host a primary pattern is anchored to and whether it also
+  // matches subdomains. Returns false for patterns without a concrete host.
+  static bool GetPatternHost(const ContentSettingsPattern& pattern,
+                             std::string* host,
+                             bool* is_domain_wildcard);
+
+ private:
+  using Bucket = std::vector<size_t>;
+
+  void AppendCandidates(const std::unordered_map<std::string, Bucket>& map,
+                        const std::string& host,
+                        std::vector<size_t>* candidates) const;
+
+  const ContentSettingsForOneType* rules_;
+  std::unordered_map<std::string, Bucket> exact_hosts_;
+  std::unordered_map<std::string, Bucket> domain_wildcards_;
+  Bucket generic_;
+
+  DISALLOW_COPY_AND_ASSIGN(ContentSettingRulesIndex);
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_RENDERER_CONTENT_SETTING_RULES_INDEX_H_
@@ -0,0 +1,115 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/renderer/content_setting_rules_index.h"
+
+#include <string>
+
+#include "components/content_settings/core/common/content_settings_pattern.h"
+#include "components/content_settings/core/common/content_settings_utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace {
+
+typedef testing::Test ContentSettingRulesIndexTest;
+using brave::ContentSettingRulesIndex;
+
+ContentSettingPatternSource MakeRule(const std::string& primary,
+                                     ContentSetting setting) {
+  return ContentSettingPatternSource(
+      ContentSettingsPattern::FromString(primary),
+      ContentSettingsPattern::Wildcard(),
+      base::Value::FromUniquePtrValue(
+          content_settings::ContentSettingToValue(setting)),
+      std::string(),
+      false);
+}
+
+TEST_F(ContentSettingRulesIndexTest, GetPatternHost) {
+  std::string host;
+  bool is_domain_wildcard = false;
+  EXPECT_TRUE(ContentSettingRulesIndex::GetPatternHost(
+      ContentSettingsPattern::FromString("[*.]brave.com"),
+      &host, &is_domain_wildcard));
+  EXPECT_EQ("brave.com", host);
+  EXPECT_TRUE(is_domain_wildcard);
+
+  EXPECT_TRUE(ContentSettingRulesIndex::GetPatternHost(
+      ContentSettingsPattern::FromString("https://www.brave.com:443"),
+      &host, &is_domain_wildcard));
+  EXPECT_EQ("www.brave.com", host);
+  EXPECT_FALSE(is_domain_wildcard);
+
+  EXPECT_FALSE(ContentSettingRulesIndex::GetPatternHost(
+      ContentSettingsPattern::Wildcard(), &host, &is_domain_wildcard));
+  EXPECT_FALSE(ContentSettingRulesIndex::GetPatternHost(
+      ContentSettingsPattern::FromString("file:///tmp/index.html"),
+      &host, &is_domain_wildcard));
+}
+
+TEST_F(ContentSettingRulesIndexTest, MatchesInPrecedenceOrder) {
+  ContentSettingsForOneType rules;
+  rules.push_back(MakeRule("https://www.brave.com", CONTENT_SETTING_ALLOW));
+  rules.push_back(MakeRule("[*.]example.com", CONTENT_SETTING_BLOCK));
+  rules.push_back(MakeRule("[*.]brave.com", CONTENT_SETTING_BLOCK));
+  rules.push_back(MakeRule("*", CONTENT_SETTING_ASK));
+
+  ContentSettingRulesIndex index;
+  index.Build(rules);
+
+  auto matches = index.GetMatchingRules(GURL("https://www.brave.com/"));
+  ASSERT_EQ(3u, matches.size());
+  EXPECT_EQ(rules[0].primary_pattern, matches[0]->primary_pattern);
+  EXPECT_EQ(rules[2].primary_pattern, matches[1]->primary_pattern);
+  EXPECT_EQ(rules[3].primary_pattern, matches[2]->primary_pattern);
+
+  matches = index.GetMatchingRules(GURL("http://brave.com/"));
+  ASSERT_EQ(2u, matches.size());
+  EXPECT_EQ(rules[2].primary_pattern, matches[0]->primary_pattern);
+  EXPECT_EQ(rules[3].primary_pattern, matches[1]->primary_pattern);
+
+  matches = index.GetMatchingRules(GURL("https://notbrave.com/"));
+  ASSERT_EQ(1u, matches.size());
+  EXPECT_EQ(rules[3].primary_pattern, matches[0]->primary_pattern);
+}
+
+TEST_F(ContentSettingRulesIndexTest, RebuildAfterRulesReplaced) {
+  ContentSettingsForOneType rules;
+  rules.push_back(MakeRule("https://www.brave.com", CONTENT_SETTING_ALLOW));
+  rules.push_back(MakeRule("[*.]example.com", CONTENT_SETTING_BLOCK));
+  rules.push_back(MakeRule("[*.]brave.com", CONTENT_SETTING_BLOCK));
+
+  ContentSettingRulesIndex index;
+  index.Build(rules);
+  auto matches = index.GetMatchingRules(GURL("https://www.brave.com/"));
+  ASSERT_EQ(2u, matches.size());
+  EXPECT_EQ(CONTENT_SETTING_ALLOW, matches[0]->GetContentSetting());
+
+  // RendererContentSettingRules are reassigned in place on updates.
+  ContentSettingsForOneType new_rules;
+  new_rules.push_back(MakeRule("[*.]brave.com", CONTENT_SETTING_BLOCK));
+  rules = new_rules;
+
+  index.Build(rules);
+  matches = index.GetMatchingRules(GURL("https://www.brave.com/"));
+  ASSERT_EQ(1u, matches.size());
+  EXPECT_EQ(CONTENT_SETTING_BLOCK, matches[0]->GetContentSetting());
+  EXPECT_TRUE(index.GetMatchingRules(GURL("https://example.com/")).empty());
+}
+
+TEST_F(ContentSettingRulesIndexTest, EmptyIndex) {
+  ContentSettingRulesIndex index;
+  EXPECT_TRUE(index.empty());
+  EXPECT_TRUE(index.GetMatchingRules(GURL("https://brave.com/")).empty());
+
+  ContentSettingsForOneType rules;
+  rules.push_back(MakeRule("[*.]brave.com", CONTENT_SETTING_BLOCK));
+  index.Build(rules);
+  EXPECT_FALSE(index.empty());
+  index.Clear();
+  EXPECT_TRUE(index.empty());
+}
+
+}  // namespace